@@ -53,6 +53,7 @@ public:
         /**
          * @brief getLCM_Obj: application request its own LCM object that handles the application's lifecycle state depending on the state of the dependent services
          *              and lifecycle state notified from TCU
+         *              The persistence prefetch of the bundle (pcl_prefetchBundle, dss_NamespacePrefetch) is started by this call.
          * @param[in] pAppBndlContext: bundle context of the application
          * @param[in] mandatoryServices: services mandatory for the bundle
          * @param[in] optionalServices: a map of services considered optional (their presence is not critical) (key = service name, value = service state)
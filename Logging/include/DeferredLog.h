@@ -0,0 +1,262 @@
+/**
+ * \file
+ *         DeferredLog.h
+ * \brief
+ *         Deferred-format logging helpers for the Logging Service binary log engine
+ * 
+ * \par Copyright Notice:
+ * \verbatim
+ * Copyright (c) 2021 Stellantis N.V.
+ * All Rights Reserved.
+ * The reproduction, transmission or use of this document or its contents is
+ * not permitted without express written authority.
+ * Offenders will be liable for damages. All rights, including rights created
+ * by patent grant or registration of a utility model or design, are reserved.
+ * \endverbatim
+ */
+
+#ifndef LOGGING_SERVICE_DEFERRED_LOG_H_
+#define LOGGING_SERVICE_DEFERRED_LOG_H_
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "ILoggingService.h"
+
+/**
+ * @brief Log a message without formatting it on the calling thread.
+ *
+ * The format string is registered once per call site (first execution) and only its identifier and the raw
+ * argument bytes are stored. The message is formatted by the Logging Service when logs are exported with
+ * getStoredLogs or tailed with setLogTail.
+ *
+ * Usage:
+ * \code{.cpp}
+ * STLA_LOG_DEFERRED(_logService, _sourceId, Poco::PRIO_INFORMATION, "speed %f heading %u", speed, heading);
+ * \endcode
+ *
+ * Supported arguments are integral, floating point, boolean and enumeration values, C strings and std::string.
+ * Other pointers are rejected at compile time.
+ * The format string must be a string literal. The identifier is kept in a static of the call site, which stays valid
+ * after a restart of the Logging Service since format identifiers are persisted (see ILoggingService::registerLogFormat).
+ * LOG_FORMAT_ID_INVALID is not kept: registration is retried on the next execution, and the message is dropped meanwhile.
+ */
+#define STLA_LOG_DEFERRED(service, sourceId, level, format, ...)                                                      \
+    do                                                                                                               \
+    {                                                                                                                \
+        static std::atomic<::Stla::LoggingService::LogFormatId_t> stlaDeferredFormatId(                              \
+            ::Stla::LoggingService::LOG_FORMAT_ID_INVALID);                                                          \
+        ::Stla::LoggingService::Deferred::log((service), (sourceId), (level),                                        \
+            ::Stla::LoggingService::Deferred::resolveFormat((service), stlaDeferredFormatId, (format)), ##__VA_ARGS__); \
+    } while (0)
+
+namespace Stla
+{
+namespace LoggingService
+{
+namespace Deferred
+{
+
+/**
+ * \brief Maximum size of the raw arguments of one record, including the ARG_TRUNCATED tag.
+ * A string exceeding the remaining space is clipped, the following arguments are dropped, and the record ends with ARG_TRUNCATED.
+ */
+const uint16_t MAX_ARGS_SIZE = 256;
+
+/**
+ * \brief The ArgType_t defines the tag preceding each raw argument in a record.
+ */
+//@serialize
+enum ArgType_t : uint8_t
+{
+    ARG_INT32,                /**< 4 bytes signed integer */
+    ARG_UINT32,               /**< 4 bytes unsigned integer */
+    ARG_INT64,                /**< 8 bytes signed integer */
+    ARG_UINT64,               /**< 8 bytes unsigned integer */
+    ARG_DOUBLE,               /**< 8 bytes floating point */
+    ARG_BOOL,                 /**< 1 byte boolean */
+    ARG_CHAR,                 /**< 1 byte character */
+    ARG_STRING,               /**< 2 bytes length followed by the characters, not null terminated */
+    ARG_TRUNCATED             /**< Last tag of a record whose arguments did not fit in MAX_ARGS_SIZE */
+};
+
+/**
+ * \brief Stack buffer used to capture the raw arguments of one record.
+ */
+struct ArgsBuffer
+{
+    /** Arguments stop one byte before MAX_ARGS_SIZE, so there is always room for ARG_TRUNCATED */
+    static const uint16_t CAPACITY = MAX_ARGS_SIZE - 1u;
+
+    uint8_t data[MAX_ARGS_SIZE];
+    uint16_t size;
+    bool truncated;
+
+    ArgsBuffer() : size(0), truncated(false) {}
+
+    void put(ArgType_t type, const void *value, uint16_t valueSize)
+    {
+        if (truncated || size + 1u + valueSize > CAPACITY)
+        {
+            truncated = true;
+            return;
+        }
+        data[size++] = type;
+        std::memcpy(&data[size], value, valueSize);
+        size = static_cast<uint16_t>(size + valueSize);
+    }
+
+    void putString(const char *value, std::size_t length)
+    {
+        const uint16_t headerSize = 1u + sizeof(uint16_t);
+        if (truncated || size + headerSize > CAPACITY)
+        {
+            truncated = true;
+            return;
+        }
+        const uint16_t maxLength = static_cast<uint16_t>(CAPACITY - size - headerSize);
+        uint16_t storedLength = static_cast<uint16_t>(length);
+        if (length > maxLength)
+        {
+            storedLength = maxLength;
+            truncated = true;
+        }
+        data[size++] = ARG_STRING;
+        std::memcpy(&data[size], &storedLength, sizeof(storedLength));
+        size = static_cast<uint16_t>(size + sizeof(storedLength));
+        std::memcpy(&data[size], value, storedLength);
+        size = static_cast<uint16_t>(size + storedLength);
+    }
+
+    void finish()
+    {
+        if (truncated)
+        {
+            data[size++] = ARG_TRUNCATED;
+        }
+    }
+};
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value>::type
+encode(ArgsBuffer &buffer, T value)
+{
+    if (sizeof(T) <= sizeof(int32_t))
+    {
+        if (std::is_signed<T>::value)
+        {
+            const int32_t v = static_cast<int32_t>(value);
+            buffer.put(ARG_INT32, &v, sizeof(v));
+        }
+        else
+        {
+            const uint32_t v = static_cast<uint32_t>(value);
+            buffer.put(ARG_UINT32, &v, sizeof(v));
+        }
+    }
+    else if (std::is_signed<T>::value)
+    {
+        const int64_t v = static_cast<int64_t>(value);
+        buffer.put(ARG_INT64, &v, sizeof(v));
+    }
+    else
+    {
+        const uint64_t v = static_cast<uint64_t>(value);
+        buffer.put(ARG_UINT64, &v, sizeof(v));
+    }
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value>::type
+encode(ArgsBuffer &buffer, T value)
+{
+    const double v = static_cast<double>(value);
+    buffer.put(ARG_DOUBLE, &v, sizeof(v));
+}
+
+inline void encode(ArgsBuffer &buffer, bool value)
+{
+    const uint8_t v = value ? 1 : 0;
+    buffer.put(ARG_BOOL, &v, sizeof(v));
+}
+
+inline void encode(ArgsBuffer &buffer, char value)
+{
+    buffer.put(ARG_CHAR, &value, sizeof(value));
+}
+
+inline void encode(ArgsBuffer &buffer, const char *value)
+{
+    if (value == nullptr)
+    {
+        value = "(null)";
+    }
+    buffer.putString(value, std::strlen(value));
+}
+
+inline void encode(ArgsBuffer &buffer, char *value)
+{
+    encode(buffer, static_cast<const char *>(value));
+}
+
+/** Pointers other than C strings would silently convert to bool */
+template <typename T>
+void encode(ArgsBuffer &buffer, T *value) = delete;
+
+template <typename T>
+inline typename std::enable_if<std::is_enum<T>::value>::type
+encode(ArgsBuffer &buffer, T value)
+{
+    encode(buffer, static_cast<typename std::underlying_type<T>::type>(value));
+}
+
+inline void encode(ArgsBuffer &buffer, const std::string &value)
+{
+    buffer.putString(value.data(), value.size());
+}
+
+/**
+ * @brief Return the format identifier cached by a call site, registering the format if it is not cached yet.
+ * Used by STLA_LOG_DEFERRED; an invalid identifier is not cached.
+ */
+template <typename ServicePtr>
+inline LogFormatId_t resolveFormat(const ServicePtr &service, std::atomic<LogFormatId_t> &cache, const char *format)
+{
+    LogFormatId_t formatId = cache.load(std::memory_order_relaxed);
+    if (formatId == LOG_FORMAT_ID_INVALID)
+    {
+        formatId = service->registerLogFormat(format);
+        if (formatId != LOG_FORMAT_ID_INVALID)
+        {
+            cache.store(formatId, std::memory_order_relaxed);
+        }
+    }
+    return formatId;
+}
+
+/**
+ * @brief Capture the arguments and write the record. Used by STLA_LOG_DEFERRED.
+ * @return  Returns 1 if the record was stored, 0 if it was dropped (see ILoggingService::logRecord)
+ */
+template <typename ServicePtr, typename... Args>
+inline bool log(const ServicePtr &service, LogSourceId_t sourceId, Poco::Priority level, LogFormatId_t formatId, const Args &... args)
+{
+    if (formatId == LOG_FORMAT_ID_INVALID || sourceId == LOG_SOURCE_ID_INVALID)
+    {
+        return false;
+    }
+    ArgsBuffer buffer;
+    int expand[] = {0, (encode(buffer, args), 0)...};
+    (void)expand;
+    buffer.finish();
+    return service->logRecord(sourceId, level, formatId, buffer.data, buffer.size);
+}
+
+} // namespace Deferred
+} // namespace LoggingService
+} // namespace Stla
+
+#endif
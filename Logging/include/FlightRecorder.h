@@ -0,0 +1,183 @@
+/**
+ * \file
+ *         FlightRecorder.h
+ * \brief
+ *         In-memory log flight recorder of the Logging Service
+ * 
+ * \par Copyright Notice:
+ * \verbatim
+ * Copyright (c) 2021 Stellantis N.V.
+ * All Rights Reserved.
+ * The reproduction, transmission or use of this document or its contents is
+ * not permitted without express written authority.
+ * Offenders will be liable for damages. All rights, including rights created
+ * by patent grant or registration of a utility model or design, are reserved.
+ * \endverbatim
+ */
+
+#ifndef LOGGING_SERVICE_FLIGHT_RECORDER_H_
+#define LOGGING_SERVICE_FLIGHT_RECORDER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include "ILoggingServiceTypes.h"
+#include "DeferredLog.h"
+
+namespace Stla
+{
+namespace LoggingService
+{
+
+/**
+ * \brief Value of FlightRecorderRegion_t::magic once the region is initialized by the Logging Service.
+ */
+const uint32_t FLIGHT_RECORDER_MAGIC = 0x464C5452u;
+
+/**
+ * \brief Maximum size of the raw arguments of a flight recorder record, including the ARG_TRUNCATED tag.
+ * Arguments which do not fit are dropped whole and the record ends with ARG_TRUNCATED (see recordFlight).
+ */
+const uint8_t FLIGHT_RECORDER_MAX_ARGS_SIZE = 40;
+
+/**
+ * \brief The FlightRecorderSlot_t is one record of the flight recorder ring (64 bytes).
+ * sequence is set to 0 while the slot is written and to the record index + 1 once complete, so torn slots
+ * are detected when the ring is dumped after a crash.
+ */
+struct alignas(64) FlightRecorderSlot_t
+{
+    std::atomic<uint32_t> sequence;                   /**< Record index + 1, 0 while the slot is written */
+    LogFormatId_t formatId;                           /**< Format of the message, see ILoggingService::registerLogFormat */
+    uint64_t timestamp;                               /**< Monotonic time [us] of FlightRecorderRegion_t::bootId, as LogRecordHeader_t::timestamp */
+    LogSourceId_t sourceId;                           /**< Source of the message, see ILoggingService::registerLogSource */
+    uint8_t level;                                    /**< POCO priority of the message */
+    uint8_t argsSize;                                 /**< Size of args in bytes */
+    uint8_t reserved[4];
+    uint8_t args[FLIGHT_RECORDER_MAX_ARGS_SIZE];      /**< Raw arguments of the message, encoded as by STLA_LOG_DEFERRED */
+};
+
+static_assert(sizeof(FlightRecorderSlot_t) == 64, "FlightRecorderSlot_t must fill one cache line");
+
+/**
+ * \brief The FlightRecorderRegion_t is the header of the flight recorder ring, located in a memory region reserved by
+ * the platform which keeps its content across a warm reset. It is followed by slotCount slots.
+ * At startup the Logging Service dumps the records left by the previous boot if needed, then resets the ring and sets
+ * bootId before the region is returned by ILoggingService::getFlightRecorder, so all slots belong to bootId.
+ * The header is padded to 64 bytes and the reserved region starts on a 64 bytes boundary, so each slot fills exactly
+ * one cache line.
+ */
+struct alignas(64) FlightRecorderRegion_t
+{
+    uint32_t magic;                                   /**< FLIGHT_RECORDER_MAGIC when the region is valid */
+    uint32_t slotCount;                               /**< Number of slots, power of two */
+    std::atomic<uint64_t> writeIndex;                 /**< Index of the next record */
+    std::atomic<uint32_t> cleanShutdown;              /**< Set to 1 after the dump done on E_LCM_ST_BEFORE_SLEEP, reset to 0 when the
+                                                           lifecycle leaves E_LCM_ST_BEFORE_SLEEP (back to nominal) and at startup */
+    uint16_t bootId;                                  /**< Boot the records belong to, see LogBootInfo_t */
+    uint16_t reserved;
+    std::atomic<int64_t> realtimeOffset;              /**< Latest LogBootInfo_t::realtimeOffset of bootId, updated by the service */
+
+    FlightRecorderSlot_t *slots()
+    {
+        return reinterpret_cast<FlightRecorderSlot_t *>(this + 1);
+    }
+};
+
+static_assert(sizeof(FlightRecorderRegion_t) == 64, "FlightRecorderRegion_t must be padded to one cache line");
+
+/**
+ * @brief Return the size of the longest prefix of encoded arguments made of whole arguments and fitting in maxSize bytes.
+ * @param[in]   args : arguments encoded as by STLA_LOG_DEFERRED
+ * @param[in]   argsSize : size of args in bytes
+ * @param[in]   maxSize : maximum size of the prefix
+ * @return  size of the prefix in bytes
+ */
+inline uint16_t flightArgsPrefix(const uint8_t *args, uint16_t argsSize, uint16_t maxSize)
+{
+    uint16_t pos = 0;
+    while (pos < argsSize)
+    {
+        uint32_t argSize;
+        switch (args[pos])
+        {
+        case Deferred::ARG_INT32:
+        case Deferred::ARG_UINT32:
+            argSize = 1u + 4u;
+            break;
+        case Deferred::ARG_INT64:
+        case Deferred::ARG_UINT64:
+        case Deferred::ARG_DOUBLE:
+            argSize = 1u + 8u;
+            break;
+        case Deferred::ARG_BOOL:
+        case Deferred::ARG_CHAR:
+            argSize = 1u + 1u;
+            break;
+        case Deferred::ARG_STRING:
+        {
+            uint16_t length = 0;
+            if (pos + 3u > argsSize)
+            {
+                return pos;
+            }
+            std::memcpy(&length, &args[pos + 1u], sizeof(length));
+            argSize = 3u + length;
+            break;
+        }
+        default:
+            return pos;
+        }
+        if (pos + argSize > maxSize || pos + argSize > argsSize)
+        {
+            return pos;
+        }
+        pos = static_cast<uint16_t>(pos + argSize);
+    }
+    return pos;
+}
+
+/**
+ * @brief Write one record in the flight recorder ring. The call does not lock and never blocks: the oldest record is overwritten.
+ * Arguments larger than FLIGHT_RECORDER_MAX_ARGS_SIZE are cut at an argument boundary and end with ARG_TRUNCATED,
+ * so the dump can always decode them.
+ * @param[in]   region : region returned by ILoggingService::getFlightRecorder
+ * @param[in]   sourceId : source identifier returned by registerLogSource
+ * @param[in]   level : POCO priority
+ * @param[in]   formatId : format identifier returned by registerLogFormat
+ * @param[in]   timestamp : timestamp of the message, same time base as LogRecordHeader_t::timestamp
+ * @param[in]   args : raw arguments of the message, encoded as by STLA_LOG_DEFERRED
+ * @param[in]   argsSize : size of args in bytes
+ */
+inline void recordFlight(FlightRecorderRegion_t *region, LogSourceId_t sourceId, uint8_t level, LogFormatId_t formatId,
+                         uint64_t timestamp, const void *args, uint16_t argsSize)
+{
+    const uint64_t index = region->writeIndex.fetch_add(1, std::memory_order_relaxed);
+    FlightRecorderSlot_t &slot = region->slots()[index & (region->slotCount - 1u)];
+
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.formatId = formatId;
+    slot.timestamp = timestamp;
+    slot.sourceId = sourceId;
+    slot.level = level;
+    if (argsSize <= FLIGHT_RECORDER_MAX_ARGS_SIZE)
+    {
+        slot.argsSize = static_cast<uint8_t>(argsSize);
+        std::memcpy(slot.args, args, argsSize);
+    }
+    else
+    {
+        const uint16_t kept = flightArgsPrefix(static_cast<const uint8_t *>(args), argsSize, FLIGHT_RECORDER_MAX_ARGS_SIZE - 1u);
+        std::memcpy(slot.args, args, kept);
+        slot.args[kept] = Deferred::ARG_TRUNCATED;
+        slot.argsSize = static_cast<uint8_t>(kept + 1u);
+    }
+    slot.sequence.store(static_cast<uint32_t>(index + 1u), std::memory_order_release);
+}
+
+} // namespace LoggingService
+} // namespace Stla
+
+#endif
@@ -29,7 +29,7 @@
 #include "Poco/BasicEvent.h"
 
 //To do - Logger file header addition
-#include "Poco/Logger.h
+#include "Poco/Logger.h"
 
 /* Logging Service bundle includes */
 
@@ -39,6 +39,9 @@ namespace Stla
 {
 namespace LoggingService
 {
+/* Flight recorder ring, see FlightRecorder.h */
+struct FlightRecorderRegion_t;
+
 /**
  * @brief The logging service shall provide an interface to trigger the * saving of logs in persistent storage. 
  * The interface shall enable to
@@ -74,6 +77,9 @@ public:
          * @param[in]   loglevel : POCO priority 
 		 * @param[in]   filter :  (AppId+ CtxID) provided by App to reduce log size. The filter format is "ApplicationId ContextId, ApplicationId ContextId, ...".
 		 *\n Example: "MCH3 DALC, SYS JOUR, MCH1 EINI"
+		 *\n An entry can be followed by ":priority" to override loglevel for that source, and "*" matches all sources.
+		 *\n Example: "MCH3 DALC:8, *:3"
+		 *\n The filter is compiled once by this call (see compileLogFilter); the request is ignored if the filter is invalid.
 		 * @param[in]  nLC_activation : Nb of cycles given by application for automatic activation at start up. Maximum to be defined with STLA.		 		 
 		 * @return  Returns 1 for valid request
          * \n       Returns 0 if the request is ignored.
@@ -94,11 +100,23 @@ public:
          * @brief Get Stored Logs 
          *
          * @param[in]   logType : Based on the architecture, log type can be "Full TCU trace or NAD" 
+		 * Binary records (see logRecord) are formatted when they are exported.
 		 * @return  Returns the file descriptor to the last log storage file. 
          * \n       Returns -1 if there is no such file
          */
 		virtual int getStoredLogs(int logType=0) = 0;
 		
+		/**
+		 * @brief Export the stored logs matching a time window, a minimum priority and a filter as a compressed archive.
+		 * Each segment keeps an index of its blocks (time range, highest priority, sources), so only the blocks
+		 * matching the request are read from flash.
+		 * @param[in]   request : selection and compression of the export
+		 * @return  Returns a file descriptor from which the archive is streamed; end of file marks the end of the archive.
+		 * The caller closes the descriptor.
+		 * \n       Returns -1 if the request is invalid or there are no stored logs
+		 */
+		virtual int exportLogs(const LogExportRequest_t &request) = 0;
+
 		/**
 		 * @brief Notify when log storage stops (stopLogStorage request or reaching LOG_STORAGE_LIMIT)
 		*/
@@ -110,6 +128,114 @@ public:
          * \n       ERROR if operation is failed 
         */
 		virtual Logging_Error_t clearLogStorage() = 0; 
+
+		/**
+		 * @brief Register a log source and return its identifier. Registering the same name again returns the same identifier.
+		 * @param[in]   sourceName : name of the source, typically "ApplicationId ContextId"
+		 * @return  Identifier of the source, to be used in logRecord
+		 * \n       LOG_SOURCE_ID_INVALID if the source table is full or the service is not ready yet; registration can be retried
+		 */
+		virtual LogSourceId_t registerLogSource(const std::string &sourceName) = 0;
+
+		/**
+		 * @brief Register a log message format and return its identifier. Registering the same format again returns the same identifier.
+		 * The format table is persisted with the segments, so identifiers stay the same across restarts of the service and
+		 * across boots; callers may keep them (see STLA_LOG_DEFERRED). The same applies to registerLogSource.
+		 * @param[in]   format : Poco::format format string of the message
+		 * @return  Identifier of the format, to be used in logRecord
+		 * \n       LOG_FORMAT_ID_INVALID if the format table is full or the service is not ready yet; registration can be retried
+		 */
+		virtual LogFormatId_t registerLogFormat(const std::string &format) = 0;
+
+		/**
+		 * @brief Compile a filter expression, with the same format as the startLogStorage filter, into a filter program.
+		 * Sources of the filter which are not registered yet are registered (see registerLogSource).
+		 * @param[in]   filter : filter expression, empty to accept all sources
+		 * @param[in]   loglevel : POCO priority used for the entries without ":priority"
+		 * @param[out]  program : compiled filter, evaluated with LogFilterProgram_t::matches
+		 * @return  SUCCESS if the filter is compiled
+		 * \n       ERROR if the filter expression is invalid
+		 */
+		virtual Logging_Error_t compileLogFilter(const std::string &filter, Poco::Priority loglevel, LogFilterProgram_t &program) = 0;
+
+		/**
+		 * @brief Write a binary log record. The record is copied in the buffer of the calling thread without lock;
+		 * a background writer drains the thread buffers into the rotating segments.
+		 * The record is also written in the flight recorder (see getFlightRecorder), even if the engine is not started.
+		 * @param[in]   sourceId : source identifier returned by registerLogSource
+		 * @param[in]   level : POCO priority
+		 * @param[in]   formatId : format identifier returned by registerLogFormat
+		 * @param[in]   args : raw arguments of the message, in the order of the format
+		 * @param[in]   argsSize : size of args in bytes
+		 * @return  Returns 1 if the record was stored
+		 * \n       Returns 0 if the record was dropped (invalid source or format identifier, engine not started, rejected by the loglevel and filter given to
+		 * startBinaryLogStorage, or thread buffer full)
+		 */
+		virtual bool logRecord(LogSourceId_t sourceId, Poco::Priority level, LogFormatId_t formatId, const void *args, uint16_t argsSize) = 0;
+
+		/**
+		 * @brief Starts the binary log engine. Unlike startLogStorage, the engine does not stop at LOG_STORAGE_LIMIT:
+		 * segments are reused in a ring so flash usage stays bounded, and the engine stays active until stopBinaryLogStorage.
+		 * @param[in]   config : segments and buffers configuration
+		 * @param[in]   loglevel : POCO priority, less important records are dropped
+		 * @param[in]   filter : same format as the startLogStorage filter, records of other sources are dropped; empty to keep all sources
+		 * @return  SUCCESS if the engine is started
+		 * \n       ERROR if the configuration or the filter is invalid or the engine is already started
+		 */
+		virtual Logging_Error_t startBinaryLogStorage(const BinaryLogConfig_t &config, Poco::Priority loglevel, const std::string &filter) = 0;
+
+		/**
+		 * @brief Stops the binary log engine after the thread buffers are drained.
+		 * @return  SUCCESS if the engine is stopped
+		 * \n       ERROR if the engine was not started
+		 */
+		virtual Logging_Error_t stopBinaryLogStorage() = 0;
+
+		/**
+		 * @brief Get the binary log engine counters
+		 * @param[out]  stats : counters cumulated since the engine was started
+		 * @return  SUCCESS if stats is filled
+		 * \n       ERROR if the engine was never started
+		 */
+		virtual Logging_Error_t getBinaryLogStats(BinaryLogStats_t &stats) = 0;
+
+		/**
+		 * @brief Enable or disable the live tail of the binary log engine. While enabled, binary records are formatted
+		 * by the service and notified with logTail; otherwise they are only formatted on export.
+		 * @param[in]   enable : true to start the tail, false to stop it
+		 * @return  SUCCESS if the request is accepted
+		 * \n       ERROR if the binary log engine is not started
+		 */
+		virtual Logging_Error_t setLogTail(bool enable) = 0;
+
+		/**
+		 * @brief Get the always-on flight recorder ring, to be written with recordFlight (see FlightRecorder.h).
+		 * The ring is kept in a reserved memory region surviving a warm reset. It is dumped into the log storage
+		 * when the lifecycle state becomes E_LCM_ST_BEFORE_SLEEP, and at startup if the previous lifecycle did not end with
+		 * that dump (crash, reset, or E_LCM_WAKEUP_POWER_SUPPLY_LOST wakeup). If the lifecycle goes back from
+		 * E_LCM_ST_BEFORE_SLEEP to nominal (keep awake request, CAN wakeup), the dump is considered void again, so a later
+		 * crash is recovered at the next startup.
+		 * The region address is stable for the whole service lifetime.
+		 * @return  Pointer to the flight recorder region, nullptr if the platform does not reserve one
+		 */
+		virtual FlightRecorderRegion_t *getFlightRecorder() = 0;
+
+		/**
+		 * @brief Dump the flight recorder ring into the log storage now
+		 * @return  SUCCESS if the ring is dumped
+		 * \n       ERROR if there is no flight recorder or the storage is not available
+		 */
+		virtual Logging_Error_t dumpFlightRecorder() = 0;
+
+		/**
+		 * @brief Notify when the flight recorder was dumped; the parameter is true if the dump recovers an abnormally ended lifecycle
+		*/
+		Poco::BasicEvent<const bool> flightRecorderDumped;
+
+		/**
+		 * @brief Notify each formatted binary record while the live tail is enabled (see setLogTail)
+		*/
+		Poco::BasicEvent<const std::string> logTail;
 				
         /**
         * @brief Returns the type information for the object's class
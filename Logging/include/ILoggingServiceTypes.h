@@ -17,6 +17,9 @@
 
 #include <string>
 #include <list>
+#include <vector>
+#include <cstdint>
+#include "Poco/Logger.h"
 #ifndef LOGGING_SERVICE_TYPES_H_
 #define LOGGING_SERVICE_TYPES_H_
 
@@ -35,6 +38,130 @@ enum Logging_Error_t
     ERROR                    /**< Returned in case of operation failure due to an internal communication error */    
 };
 
+/**
+ * \brief Identifier of a log source, returned by ILoggingService::registerLogSource.
+ */
+typedef uint16_t LogSourceId_t;
+
+/**
+ * \brief Value returned by ILoggingService::registerLogSource when the source can not be registered.
+ */
+const LogSourceId_t LOG_SOURCE_ID_INVALID = 0xFFFFu;
+
+/**
+ * \brief Identifier of a log message format, returned by ILoggingService::registerLogFormat.
+ */
+typedef uint32_t LogFormatId_t;
+
+/**
+ * \brief Value returned by ILoggingService::registerLogFormat when the format can not be registered.
+ */
+const LogFormatId_t LOG_FORMAT_ID_INVALID = 0xFFFFFFFFu;
+
+/**
+ * \brief The LogRecordHeader_t is the header of a binary log record. It is followed by argsSize bytes of raw arguments.
+ * The monotonic clock restarts at each boot, so a timestamp is only meaningful together with its bootId;
+ * the wall-clock time of a record is timestamp + LogBootInfo_t::realtimeOffset of the same boot.
+ */
+//@serialize
+struct LogRecordHeader_t
+{
+    uint64_t timestamp;       /**< Time the record was produced [us], monotonic clock of the boot */
+    LogFormatId_t formatId;   /**< Format of the message */
+    LogSourceId_t sourceId;   /**< Source of the message */
+    uint8_t level;            /**< POCO priority of the message */
+    uint8_t threadIndex;      /**< Index of the producer thread buffer */
+    uint16_t argsSize;        /**< Size of the raw arguments following the header, in bytes */
+    uint16_t bootId;          /**< Boot the record was produced in, see LogBootInfo_t */
+};
+
+/**
+ * \brief The LogBootInfo_t relates the monotonic clock of one boot to the wall clock.
+ * It is written in the current segment when the engine starts and each time the system time is synchronized,
+ * so records of previous boots kept in the segment ring can be placed on the wall clock.
+ */
+//@serialize
+struct LogBootInfo_t
+{
+    uint16_t bootId;          /**< Boot counter, persisted and incremented at each startup (wraps around) */
+    int64_t realtimeOffset;   /**< Wall-clock time [us since 1970-01-01 UTC] minus monotonic time [us] */
+    bool synchronized;        /**< false while the system time is not synchronized, the offset is then an estimate */
+};
+
+/**
+ * \brief The BinaryLogConfig_t defines the binary log engine storage configuration.
+ * Flash usage is bounded to segmentSize * segmentCount: when the last segment is full the oldest one is overwritten.
+ */
+//@serialize
+struct BinaryLogConfig_t
+{
+    uint32_t segmentSize;         /**< Size of one segment file, in KiB */
+    uint32_t segmentCount;        /**< Number of rotating segment files */
+    uint32_t threadBufferSize;    /**< Size of the in-memory buffer of each producer thread, in KiB */
+    uint32_t flushPeriodMs;       /**< Maximum time between a record production and its write to a segment */
+};
+
+/**
+ * \brief The BinaryLogStats_t defines the binary log engine counters, cumulated since the engine was started.
+ */
+//@serialize
+struct BinaryLogStats_t
+{
+    uint64_t recordsWritten;      /**< Records written to segments */
+    uint64_t recordsDropped;      /**< Records dropped because a thread buffer was full */
+    uint32_t segmentsRotated;     /**< Number of times the oldest segment was overwritten */
+};
+/**
+ * \brief The LogExportCompression_t defines the compression of an exported log archive.
+ */
+//@serialize
+enum LogExportCompression_t
+{
+    EXPORT_COMPRESSION_NONE,  /**< Archive is not compressed */
+    EXPORT_COMPRESSION_GZIP,  /**< Archive is gzip compressed */
+    EXPORT_COMPRESSION_ZSTD   /**< Archive is zstd compressed */
+};
+
+/**
+ * \brief The LogExportRequest_t defines the selection and the format of a log export.
+ */
+//@serialize
+struct LogExportRequest_t
+{
+    int logType;                          /**< Same as getStoredLogs logType */
+    int64_t startTime;                    /**< First wall-clock time to export [us since 1970-01-01 UTC]; record times are converted with LogBootInfo_t */
+    int64_t endTime;                      /**< Last wall-clock time to export [us since 1970-01-01 UTC] */
+    Poco::Priority minLevel;              /**< Less important POCO priority to export (records with a higher priority value are skipped) */
+    std::string filter;                   /**< Same format as startLogStorage filter, empty to export all sources */
+    LogExportCompression_t compression;   /**< Compression of the archive */
+};
+/**
+ * \brief The LogFilterProgram_t is a filter expression compiled by ILoggingService::compileLogFilter.
+ * Source names are resolved to their interned identifiers at compilation, so evaluating the filter is a table lookup
+ * and an integer compare per message.
+ * Binary records carry their source identifier. Text messages (startLogStorage) carry their source as a string
+ * ("ApplicationId ContextId"): the service resolves it with one hash lookup in the same intern table as registerLogSource,
+ * registering it on its first occurrence, then evaluates the program. High rate sources should use logRecord.
+ */
+struct LogFilterProgram_t
+{
+    std::vector<uint8_t> sourceLevels;    /**< Less important POCO priority accepted for each source identifier, 0 if the source is not accepted */
+    uint8_t defaultLevel;                 /**< Less important POCO priority accepted for sources not in sourceLevels, 0 to reject them */
+
+    LogFilterProgram_t() : defaultLevel(0) {}
+
+    /**
+     * @brief Evaluate the filter for one message
+     * @param[in]   sourceId : interned source of the message
+     * @param[in]   level : POCO priority of the message
+     * @return  true if the message passes the filter
+     */
+    bool matches(LogSourceId_t sourceId, uint8_t level) const
+    {
+        const uint8_t accepted = sourceId < sourceLevels.size() ? sourceLevels[sourceId] : defaultLevel;
+        return level <= accepted;
+    }
+};
 
 } // namespace LoggingService
 } // namespace Stla
@@ -0,0 +1,131 @@
+/**
+ * \file
+ *          IPositionPredictor.h
+ *
+ * \brief
+ *          The interface for the PositionPredictor service
+ *
+ * \par Copyright Notice:
+ * \verbatim
+ * Copyright (c) 2021 Stellantis N.V.
+ * All Rights Reserved.
+ * The reproduction, transmission or use of this document or its contents is
+ * not permitted without express written authority.
+ * Offenders will be liable for damages. All rights, including rights created
+ * by patent grant or registration of a utility model or design, are reserved.
+ * \endverbatim
+ */
+
+#ifndef IPOSITIONPREDICTOR_H
+#define IPOSITIONPREDICTOR_H
+
+#include "IPositioningServiceTypes.h"
+#include "Poco/BasicEvent.h"
+
+
+namespace Stla{
+namespace Positioning {
+
+typedef unsigned int PosStreamId;
+
+/**
+ * @brief Maximum rate of a predicted position stream [Hz]
+ */
+const unsigned int POS_PREDICTION_MAX_RATE = 50;
+
+/**
+ * @brief Maximum extrapolation time after the last enhanced position [ms]
+ */
+const uint32_t POS_PREDICTION_MAX_EXTRAPOLATION = 1000;
+
+/**
+ * @brief Description of how a predicted position was obtained.
+ */
+ //@ serialize
+typedef enum {
+    POS_PREDICTION_NONE,                /**< No enhanced position was received yet, position is not valid */
+    POS_PREDICTION_EXACT,               /**< Requested timestamp matches a received enhanced position */
+    POS_PREDICTION_INTERPOLATED,        /**< Position interpolated between two received enhanced positions */
+    POS_PREDICTION_EXTRAPOLATED,        /**< Position extrapolated from the last enhanced position using hSpeed and heading */
+    POS_PREDICTION_EXTRAPOLATED_WHEEL   /**< Position extrapolated from the last enhanced position using heading and CAN wheel speed */
+} EPositionPredictionType;
+
+/**
+ * Predicted enhanced position.
+ * TPredictedPosition::position::timestamp is the requested timestamp, not the timestamp of the
+ * enhanced position used as base.
+ */
+typedef struct {
+    TEnhancedPosition position;         /**< Predicted position. validityBits are inherited from the base enhanced position. */
+    EPositionPredictionType type;       /**< How the position was obtained. */
+    uint32_t baseAge;                   /**< Time between the base enhanced position and the requested timestamp [ms]. */
+} TPredictedPosition;
+
+typedef struct{
+    PosStreamId stream_id;
+    TPredictedPosition data;
+}PredictedPos_Payload;
+
+/**
+ * @brief The IPositionPredictor interface provides enhanced positions at an arbitrary rate.
+ *
+ * It is fed by IPositioningService::enhancedPositionUpdateEvent and keeps only the last received
+ * enhanced positions. Positions between two updates are interpolated, positions after the last
+ * update are extrapolated from hSpeed and heading, or from the CAN wheel speed when fusion is enabled
+ * and the signal is available. Extrapolation is limited to POS_PREDICTION_MAX_EXTRAPOLATION ms.
+ */
+#ifdef DOXYGEN_WORKING
+class IPositionPredictor
+#else
+class __attribute__((visibility("default"))) IPositionPredictor
+#endif
+{
+public:
+
+    /**
+     * @brief IPositionPredictor: default destructor
+     */
+    virtual ~IPositionPredictor() = default;
+
+    /**
+     * @brief Event triggered at the requested rate for every started position stream
+     * @param PredictedPos_Payload struct containing the stream id and the predicted position
+     */
+    Poco::BasicEvent<const PredictedPos_Payload> predictedPositionDeliverEvent;
+
+    /**
+     * @brief Function used to get the position at a given timestamp
+     * The computation is done in constant time, without any call to the positioning service.
+     * @param timestamp: Timestamp of the requested position [ms], same time source as TEnhancedPosition::timestamp
+     * @return: The predicted position. If timestamp is older than the kept positions or newer than the last
+     *          position plus POS_PREDICTION_MAX_EXTRAPOLATION, the type is set to POS_PREDICTION_NONE.
+     *          Extrapolation needs ENH_POSITION_HEADING_VALID, and ENH_POSITION_HSPEED_VALID or the CAN wheel speed, in the
+     *          last enhanced position; otherwise the type of a position after the last one is POS_PREDICTION_NONE.
+     */
+    virtual TPredictedPosition positionAt(uint64_t timestamp) = 0;
+
+    /**
+     * @brief Function used to start a fixed rate stream of predicted positions
+     * @param rate: Stream rate in Hz, 1 - POS_PREDICTION_MAX_RATE
+     * @return: Unique streamID, 0 if the rate is not supported. The streamIDs are unique only in the context of this instance.
+     *          It will be used to stop the stream or to identify the positions in predictedPositionDeliverEvent
+     */
+    virtual PosStreamId startPositionStream(unsigned int rate) = 0;
+
+    /**
+     * @brief Stop a position stream
+     * @param stream_id: The id of the stream to be stopped
+     * @return true if the stream was stopped, false if there was no active/valid stream
+     */
+    virtual bool stopPositionStream(const PosStreamId& stream_id) = 0;
+
+    /**
+     * @brief Enable or disable the use of the CAN wheel speed for extrapolation
+     * @param enable: true to use the wheel speed when available, false to use only TEnhancedPosition::hSpeed
+     */
+    virtual void setWheelSpeedFusion(bool enable) = 0;
+};
+
+}
+}
+#endif // IPOSITIONPREDICTOR_H
@@ -0,0 +1,113 @@
+/**
+ * \file
+ *          IPositionSnapshot.h
+ * \brief
+ *          Positioning service shared snapshot block
+ * 
+ * \par Copyright Notice:
+ * \verbatim
+ * Copyright (c) 2021 Stellantis N.V.
+ * All Rights Reserved.
+ * The reproduction, transmission or use of this document or its contents is
+ * not permitted without express written authority.
+ * Offenders will be liable for damages. All rights, including rights created
+ * by patent grant or registration of a utility model or design, are reserved.
+ * \endverbatim
+ */
+
+#ifndef IPOSITION_SNAPSHOT_H_
+#define IPOSITION_SNAPSHOT_H_
+
+#include <atomic>
+#include <cstring>
+#include "genivi/gnss.h"
+#include "IPositioningServiceTypes.h"
+
+namespace Stla
+{
+    namespace Positioning
+    {
+        /**
+         * Values of the positioning hot accessors, as published together by the service.
+         */
+        typedef struct {
+            TGNSSPosition gnssPosition;             /**< Same value as returned by IPositioningService::getGNSSPosition. */
+            TGNSSPosition lastValidGNSSPosition;    /**< Same value as returned by IPositioningService::getLastValidGNSSPosition. */
+            TEnhancedPosition enhancedPosition;     /**< Same value as returned by IPositioningService::getEnhancedPosition. */
+            uint32_t traveledDistance;              /**< Same value as returned by IPositioningService::getTraveledDistance [m]. */
+        } TPositionSnapshot;
+
+        /**
+         * Shared memory block written by the Positioning service once per update.
+         *
+         * The block is protected by a sequence lock: the service increments @ref sequence before
+         * and after writing @ref data, so an odd value means an update is in progress.
+         * A @ref sequence value of 0 means that no data was published yet; when the counter wraps,
+         * the service skips 0 so a published block never reads as unpublished.
+         *
+         * \note The block shall only be read with \link readPositionSnapshot \endlink.
+         */
+        typedef struct {
+            std::atomic<uint32_t> sequence;         /**< Sequence lock counter. */
+            TPositionSnapshot data;                 /**< Last published values. */
+        } TPositionSnapshotBlock;
+
+        /**
+         * Result of \link readPositionSnapshot \endlink.
+         */
+		 //@ serialize
+        typedef enum {
+            POS_SNAPSHOT_OK,                        /**< A consistent copy was read. */
+            POS_SNAPSHOT_NOT_PUBLISHED,             /**< The service did not publish any data yet. */
+            POS_SNAPSHOT_BUSY                       /**< All attempts overlapped with an update (for example the service was
+                                                         preempted while writing); valid data exists, the read can be retried
+                                                         or the previously read copy kept. */
+        } EPositionSnapshotStatus;
+
+        /**
+         * \brief Read a consistent copy of the snapshot block
+         *
+         * This function does not lock and does not call the Positioning service. If the service is
+         * writing the block while it is read, the read is retried.
+         *
+         * \param[in]  block: snapshot block returned by IPositioningService::getPositionSnapshotBlock
+         * \param[out] snapshot: copy of the last published values
+         * \param[in]  maxRetries: maximum number of read attempts
+         *
+         * \return POS_SNAPSHOT_OK if a consistent copy was read, POS_SNAPSHOT_NOT_PUBLISHED if no data was
+         * published yet (or block is null), POS_SNAPSHOT_BUSY if all attempts overlapped with an update
+         */
+        inline EPositionSnapshotStatus readPositionSnapshot(const TPositionSnapshotBlock* block, TPositionSnapshot& snapshot, unsigned int maxRetries = 16)
+        {
+            if(block == nullptr)
+            {
+                return POS_SNAPSHOT_NOT_PUBLISHED;
+            }
+
+            for(unsigned int attempt = 0; attempt < maxRetries; ++attempt)
+            {
+                const uint32_t before = block->sequence.load(std::memory_order_acquire);
+                if(before == 0)
+                {
+                    return POS_SNAPSHOT_NOT_PUBLISHED;
+                }
+                if((before & 1u) != 0)
+                {
+                    continue;
+                }
+
+                std::memcpy(&snapshot, &block->data, sizeof(TPositionSnapshot));
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if(block->sequence.load(std::memory_order_relaxed) == before)
+                {
+                    return POS_SNAPSHOT_OK;
+                }
+            }
+
+            return POS_SNAPSHOT_BUSY;
+        }
+    }
+}
+
+#endif
@@ -29,6 +29,7 @@
 
 #include "genivi/gnss.h"
 #include "IPositioningServiceTypes.h"
+#include "IPositionSnapshot.h"
 
 namespace Stla
 {
@@ -58,6 +59,8 @@ namespace Stla
          *
          * Most of the data can be accesed by a client on demand (via getters) or
          * on notification basis. The notification is done using Poco::BasicEvent.
+         * GNSS satellite details are additionally provided as a shared snapshot and
+         * as a stream of changes.
          *
          * GNSS information is provided in GENIVI format.
          */
@@ -400,6 +403,52 @@ namespace Stla
              */
             Poco::BasicEvent<const TGNSSSatelliteDetails> gnssSatelliteDetailsUpdateEvent;
 
+            /**
+             * \brief  Getter for a shared snapshot of the GNSS satellite view
+             *
+             * This function returns the full satellite view kept by the service without
+             * copying the satellite list. The snapshot is immutable and stays valid as long as
+             * the client holds the pointer, even after newer updates were received.
+             *
+             * The satellite details have the same fields available as the ones mentioned in
+             * \link getGNSSSatelliteDetails \endlink description.
+             *
+             * \note The snapshot is the base for \link gnssSatelliteDetailsDeltaEvent \endlink:
+             * only deltas with a sequence number greater than the snapshot sequence have to be applied.
+             *
+             * \return Last updated GNSS satellite view, never null: before the first update, an empty view with sequence 0
+             */
+            virtual TGNSSSatelliteViewSnapshot getGNSSSatelliteViewSnapshot() = 0;
+
+            /**
+             * \brief Poco Event which is triggered when the GNSS satellite view has changed
+             *
+             * This event is triggered at most @1Hz, after the satellite view was updated, and carries only
+             * the satellites which were added, removed or changed since the previous update.
+             * Satellites are identified by (system, satelliteId). If no satellite has changed, the
+             * event is not triggered and the sequence number is not incremented.
+             *
+             * A client which detects a gap in the sequence numbers shall resynchronize using
+             * \link getGNSSSatelliteViewSnapshot \endlink.
+             *
+             * Usage:
+             * \code{.cpp}
+             * void ClientClass::onGnssSatelliteDetailsDelta(const TGNSSSatelliteDetailsDelta& data)
+             * {
+             *      if(data.sequence != _view.sequence + 1)
+             *      {
+             *          _view = *_posService->getGNSSSatelliteViewSnapshot();
+             *          return;
+             *      }
+             *      // Apply data.changes to _view
+             * }
+             * \endcode
+             *
+             * \warning All registered callbacks MUST be unregistered before client instance is destroyed, otherwise
+             * Macchina instance will crash!
+             */
+            Poco::BasicEvent<const TGNSSSatelliteDetailsDelta> gnssSatelliteDetailsDeltaEvent;
+
             /**
              * \brief  Getter for the GNSS time to first fix
              *
@@ -533,6 +582,34 @@ namespace Stla
              * Macchina instance will crash!
              */
             Poco::BasicEvent<const uint32_t> traveledDistanceUpdateEvent;
+
+            /**
+             * \brief  Getter for the shared position snapshot block
+             *
+             * The Positioning service keeps the values of \link getGNSSPosition \endlink,
+             * \link getLastValidGNSSPosition \endlink, \link getEnhancedPosition \endlink and
+             * \link getTraveledDistance \endlink in a shared memory block which is updated once per
+             * position update. The block address is stable for the whole service lifetime, so it can be
+             * requested once at startup and then read from any thread without calling the service.
+             *
+             * Usage:
+             * \code{.cpp}
+             * const TPositionSnapshotBlock* _snapshotBlock = _posService->getPositionSnapshotBlock();
+             *
+             * TPositionSnapshot snapshot;
+             * if(readPositionSnapshot(_snapshotBlock, snapshot) == POS_SNAPSHOT_OK)
+             * {
+             *      // Do stuff with snapshot.enhancedPosition
+             * }
+             * \endcode
+             *
+             * \note Getter should be used by clients reading the position more often than it is updated.
+             *
+             * \warning The block MUST NOT be accessed after the service was unregistered.
+             *
+             * \return Pointer to the shared position snapshot block
+             */
+            virtual const TPositionSnapshotBlock* getPositionSnapshotBlock() = 0;
         };
 
         inline IPositioningService::~IPositioningService() { }
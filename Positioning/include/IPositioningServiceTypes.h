@@ -19,6 +19,7 @@
 #define IPOSITIONINGSERVICE_TYPES_H_
 
 #include <vector>
+#include <memory>
 #include "genivi/gnss.h"
 
 namespace Stla
@@ -30,6 +31,51 @@ namespace Stla
          */
         using TGNSSSatelliteDetails = std::vector<TGNSSSatelliteDetail>;
 
+        /**
+         * @brief Description of the change carried by a satellite view delta entry.
+         */
+		 //@ serialize
+        typedef enum {
+            GNSS_SATELLITE_ADDED,               /**< Satellite was not part of the previous view */
+            GNSS_SATELLITE_UPDATED,             /**< At least one field of an already known satellite has changed, timestamp excluded */
+            GNSS_SATELLITE_REMOVED              /**< Satellite is no longer reported, only system and satelliteId are meaningful */
+        } EGNSSSatelliteChangeType;
+
+        /**
+         * Single entry of a satellite view delta.
+         * A satellite is identified by the (system, satelliteId) pair of @ref detail.
+         */
+        typedef struct {
+            EGNSSSatelliteChangeType change;    /**< Kind of change for this satellite. */
+            TGNSSSatelliteDetail detail;        /**< New satellite state (ADDED / UPDATED) or satellite key (REMOVED). */
+        } TGNSSSatelliteChange;
+
+        /**
+         * Changes of the satellite view between two consecutive updates.
+         * Only satellites that were added, removed or which have at least one changed
+         * field are part of @ref changes. TGNSSSatelliteDetail::timestamp is refreshed at each acquisition
+         * and is excluded from change detection; the time of the update is given by @ref timestamp.
+         */
+        typedef struct {
+            uint64_t timestamp;                 /**< Timestamp of the satellite details update this delta was built from [ms]. */
+            uint32_t sequence;                  /**< Sequence number of the satellite view after applying this delta.
+                                                     Incremented by one on every published delta. */
+            std::vector<TGNSSSatelliteChange> changes; /**< Changed satellites. */
+        } TGNSSSatelliteDetailsDelta;
+
+        /**
+         * Complete satellite view at a given sequence number.
+         */
+        typedef struct {
+            uint32_t sequence;                  /**< Sequence number of the satellite view, see @ref TGNSSSatelliteDetailsDelta::sequence. */
+            TGNSSSatelliteDetails satellites;   /**< All currently reported satellites. */
+        } TGNSSSatelliteView;
+
+        /**
+         *  Shared, immutable snapshot of the satellite view
+         */
+        using TGNSSSatelliteViewSnapshot = std::shared_ptr<const TGNSSSatelliteView>;
+
         /**
          * @brief Description of the fix type of the enhanced position.
          */
@@ -25,6 +25,15 @@
 
 #define DATA_STORAGE_SERVICE_NAME                                    ("stla.persistence.datastorage.service")
 #define MAX_FILENAME_SIZE                                            255
+#define DSS_MAP_ALIGNMENT                                            4096
+#define DSS_IOV_MAX                                                  1024
+#define DSS_IO_QUEUE_MAX_DEPTH                                       256
+#define DSS_SAVE_DEFAULT_DEADLINE_MS                                 5000
+/* Duration after the first access of a bundle during which its file reads are recorded in its prefetch manifest */
+#define DSS_PREFETCH_RECORD_WINDOW_MS                                10000
+#define DSS_CHANGE_FEED_NOTIFY_PERIOD_MS                             100
+#define DSS_BLOB_ID_SIZE                                             32
+#define DSS_COMPRESSION_FRAME_SIZE                                   (64 * 1024)
 
 /***** TYPEDEFS ***********************************************************/
 
@@ -51,6 +60,131 @@ typedef enum {
     DSS_SEEK_END       /* seek from the end of the file */
 }dss_SeekOffset_t;
 
+/* @brief Buffer descriptor of vectored file operations (dss_FileReadV / dss_FileWriteV) */
+typedef struct {
+    void     *buffer;     /* buffer to read into or to write from */
+    uint32_t count;       /* number of bytes to be transferred */
+    uint32_t offset;      /* offset in bytes in the file, the current file offset is not used nor updated */
+    int32_t  result;      /* [out] number of bytes transferred, or negative value representing the error code */
+}dss_IoVec_t;
+
+/* @brief Type of asynchronous I/O operation */
+//@serialize
+typedef enum {
+    DSS_IO_READ  = 0,   /* positional read, as dss_FileReadAt */
+    DSS_IO_WRITE,       /* positional write, as dss_FileWriteAt */
+    DSS_IO_SAVE         /* save of a closed file, as dss_FileSave with isSynchronous set to true */
+}dss_IoOpcode_t;
+
+/* @brief Asynchronous I/O request submitted with dss_IoSubmit.
+ * Buffers and file names must stay valid until the request completion is received. */
+typedef struct {
+    dss_IoOpcode_t opcode;      /* type of the operation */
+    int32_t        fileHandle;  /* handle of the opened file (DSS_IO_READ, DSS_IO_WRITE) */
+    int32_t        nsHandle;    /* handle of the storage namespace (DSS_IO_SAVE) */
+    char const     *fileName;   /* null terminated name of the file to save (DSS_IO_SAVE) */
+    void           *buffer;     /* buffer to read into or to write from (DSS_IO_READ, DSS_IO_WRITE) */
+    uint32_t       count;       /* number of bytes to be transferred (DSS_IO_READ, DSS_IO_WRITE) */
+    uint32_t       offset;      /* offset in bytes in the file (DSS_IO_READ, DSS_IO_WRITE) */
+    uint64_t       userData;    /* caller defined value, returned unchanged in the completion */
+}dss_IoRequest_t;
+
+/* @brief Completion of an asynchronous I/O request */
+//@serialize
+typedef struct {
+    int32_t  queueHandle;       /* handle of the queue the request was submitted to */
+    int32_t  result;            /* result of the operation, same values as the matching synchronous method */
+    uint64_t userData;          /* value given in the request */
+}dss_IoCompletion_t;
+
+/* @brief Completion callback of an asynchronous I/O queue, context is the value given to dss_IoQueueCreate */
+typedef void (* dss_IoCompletionFuncPtr_t)(const dss_IoCompletion_t *completion, void *context);
+
+/* @brief Priority of a deferred file save */
+//@serialize
+typedef enum {
+    DSS_FLUSH_PRIORITY_LOW = 0,   /* flushed when the deadline expires or with other pending saves */
+    DSS_FLUSH_PRIORITY_NORMAL,    /* default priority */
+    DSS_FLUSH_PRIORITY_HIGH       /* flushed before lower priority saves having the same deadline */
+}dss_FlushPriority_t;
+
+/* @brief Write-back statistics of the data storage service, cumulated since startup */
+//@serialize
+typedef struct {
+    uint64_t bytesRequested;      /* bytes written by applications through the data storage API */
+    uint64_t bytesFlushed;        /* bytes actually written to the storage device, after coalescing */
+    uint32_t flushCount;          /* number of flushes (one flush may contain several files and namespaces) */
+    uint32_t syncCount;           /* number of file system synchronizations */
+    uint32_t writeLatencyP99Us;   /* 99th percentile of the write call latency, in microseconds */
+}dss_WriteBackStats_t;
+
+/* @brief Prefetch statistics of a namespace, for the current lifecycle */
+//@serialize
+typedef struct {
+    uint32_t manifestFiles;       /* number of files in the namespace prefetch manifest */
+    uint32_t prefetchedFiles;     /* number of files read ahead by the prefetch */
+    uint32_t prefetchHits;        /* reads of prefetched files */
+    uint32_t prefetchTimeMs;      /* duration of the prefetch */
+    uint32_t savedTimeMs;         /* estimated read latency saved for the namespace */
+}dss_PrefetchStats_t;
+
+/* @brief Free space threshold notification of a namespace */
+//@serialize
+typedef struct {
+    int32_t  nsHandle;            /* handle of the storage namespace, or zero for the space available for all namespaces */
+    int32_t  freeSpace;           /* free space when the threshold was crossed (in KiB) */
+    uint32_t thresholdPercent;    /* threshold crossed, as set with dss_NamespaceSetFreeSpaceThreshold or dss_SetTotalFreeSpaceThreshold */
+    bool     isBelow;             /* true if free space dropped below the threshold, false if it went back above */
+}dss_SpaceThreshold_t;
+
+/* @brief Type of the last change of a shared file in the change feed */
+//@serialize
+typedef enum {
+    DSS_CHANGE_MODIFIED = 0,      /* file was created or modified, as dss_FileChangedEvent */
+    DSS_CHANGE_RELEASED,          /* file was released, as dss_FileReleasedEvent */
+    DSS_CHANGE_REMOVED            /* file was removed */
+}dss_ChangeType_t;
+
+/* @brief Entry of the shared namespace change feed. Changes of a file are coalesced in one entry. */
+//@serialize
+typedef struct {
+    char             fileName[MAX_FILENAME_SIZE + 1];   /* null terminated name of the file, not the file path */
+    dss_ChangeType_t lastChange;                        /* last change of the file */
+    uint32_t         changeCount;                       /* number of changes coalesced in this entry */
+    uint64_t         sequence;                          /* sequence number of the last change of the file */
+}dss_ChangeFeedEntry_t;
+
+/* @brief Identifier of a blob of the content-addressed store (SHA-256 of the blob content) */
+//@serialize
+typedef struct {
+    uint8_t hash[DSS_BLOB_ID_SIZE];
+}dss_BlobId_t;
+
+/* @brief Statistics of the content-addressed blob store */
+//@serialize
+typedef struct {
+    uint32_t blobCount;           /* number of distinct blobs stored */
+    uint32_t referenceCount;      /* number of files referencing a blob, in all namespaces */
+    uint64_t referencedBytes;     /* sum of the sizes of all referencing files */
+    uint64_t storedBytes;         /* bytes actually stored for the blobs */
+}dss_BlobStoreStats_t;
+
+/* @brief Compression of the data stored in a file. Files are compressed in independent frames of
+ * DSS_COMPRESSION_FRAME_SIZE logical bytes, so seeking and reading only decompress the frames accessed. */
+//@serialize
+typedef enum {
+    DSS_COMPRESSION_NONE = 0,     /* data is stored as written */
+    DSS_COMPRESSION_LZ4,          /* fast compression, for frequently written files (logs, telemetry) */
+    DSS_COMPRESSION_ZSTD          /* higher ratio, for rarely written files (configurations) */
+}dss_Compression_t;
+
+/* @brief Type of file mapping */
+//@serialize
+typedef enum {
+    DSS_MAP_READ_ONLY  = 0,       /* mapped pages can only be read */
+    DSS_MAP_READ_WRITE            /* mapped pages can be read and modified, modifications are written back to the file */
+}dss_MapMode_t;
+
 /* @brief Error codes returned by data storage service API */
 //@serialize
 typedef enum {
@@ -60,6 +194,7 @@ typedef enum {
     DSS_EINVAL          = -22,
     DSS_EEXIST          = -17,
     DSS_EBUSY           = -16,
+    DSS_EACCES          = -13,
     DSS_ENOMEM          = -12,
     DSS_ENOENT          = -2,
     DSS_EGENERIC        = -1
@@ -105,6 +240,19 @@ public:
      */
     Poco::BasicEvent<const std::string>              dss_FileReleasedEvent;
 
+    /**
+     * @brief Free space threshold event. Triggered each time the free space of a namespace (or the total free space)
+     * crosses the threshold set with dss_NamespaceSetFreeSpaceThreshold (or dss_SetTotalFreeSpaceThreshold).
+     * Applications must filter on the namespace handle, the event is common to all namespaces.
+     */
+    Poco::BasicEvent<const dss_SpaceThreshold_t>     dss_SpaceThresholdEvent;
+
+    /**
+     * @brief Shared namespace change feed event. Triggered at most once every DSS_CHANGE_FEED_NOTIFY_PERIOD_MS when shared files changed.
+     * The latest change sequence number is transmitted as parameter; changes are read with dss_ChangeFeedRead.
+     */
+    Poco::BasicEvent<const uint64_t>                 dss_ChangeFeedEvent;
+
 
     /**
      * IDataStorageService public methods
@@ -134,6 +282,7 @@ public:
 
     /**
      * @brief Return the free space of the namespace
+     *     The value is read from usage counters maintained on write, remove and save; the file system is not scanned.
      * @param[in] nsHandle: handle of the storage namespace. Obtained from dss_NamespaceOpen
      * @return. positive number representing the free space size for the specified namespace (in KiB),
      *           or a negative number in case of an error, representing the error code
@@ -145,6 +294,7 @@ public:
 
     /**
      * @brief Return the total used space (available for namespaces)
+     *     The value is read from usage counters maintained on write, remove and save; the file system is not scanned.
      * @param[in] none
      * @return. positive number representing the total used space size (in KiB),
      *           or a negative number in case of an error, representing the error code
@@ -155,6 +305,7 @@ public:
 
     /**
      * @brief Return the total free space available for namespaces
+     *     The value is read from usage counters maintained on write, remove and save; the file system is not scanned.
      * @param[in] none
      * @return. positive number representing the total free space size (in KiB),
      *           or a negative number in case of an error, representing the error code
@@ -163,6 +314,205 @@ public:
     virtual int32_t dss_GetTotalFreeSpace() = 0;
 
 
+    /**
+     * @brief Set the free space threshold of a namespace, in percent of its quota. dss_SpaceThresholdEvent is triggered
+     *     when the free space drops below the threshold and when it goes back above it.
+     * @param[in] nsHandle: handle of the storage namespace. Obtained from dss_NamespaceOpen
+     * @param[in] thresholdPercent: threshold in percent of the quota (1 to 99), zero disables the notification
+     * @return. Zero in case of success,
+     *           or a negative number in case of an error, representing the error code
+     *          DSS_EINVAL - invalid argument
+     */
+    virtual int32_t dss_NamespaceSetFreeSpaceThreshold(int32_t nsHandle, uint32_t thresholdPercent) = 0;
+
+
+    /**
+     * @brief Set the threshold of the total free space available for namespaces, in percent of the total space.
+     *     Each bundle has its own threshold, identified by the handle of its private namespace: a bundle can only set
+     *     the threshold of a namespace it opened with dss_NamespaceOpen.
+     *     dss_SpaceThresholdEvent is triggered with nsHandle set to zero each time the total free space crosses any of the
+     *     thresholds, with thresholdPercent set to the crossed threshold; applications filter on their own threshold.
+     * @param[in] nsHandle: handle of the private namespace of the caller. Obtained from dss_NamespaceOpen with DSS_PRIVATE_NAMESPACE
+     * @param[in] thresholdPercent: threshold in percent of the total space (1 to 99), zero removes the threshold of the bundle
+     * @return. Zero in case of success,
+     *           or a negative number in case of an error, representing the error code
+     *          DSS_EINVAL - invalid argument (including a handle of the shared namespace)
+     */
+    virtual int32_t dss_SetTotalFreeSpaceThreshold(int32_t nsHandle, uint32_t thresholdPercent) = 0;
+
+
+    /**
+     * @brief Return the sequence number of the latest change of the shared namespace.
+     *     Sequence numbers increase monotonically for the whole lifecycle, zero means no change yet.
+     * @param[out] sequence: latest change sequence number
+     * @return. Zero in case of success,
+     *           or a negative number in case of an error, representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_ChangeFeedGetSequence(uint64_t *sequence) = 0;
+
+
+    /**
+     * @brief Read the changes of the shared namespace since a sequence number, coalesced per file.
+     *     Each changed file is returned once, with its last change, ordered by sequence number.
+     *     If sinceSequence is older than the history kept by the service, or greater than the latest sequence number
+     *     (for example a value saved in a previous lifecycle, sequence numbers restart with each lifecycle), the feed cannot
+     *     tell what changed: resync is set and all existing shared files are returned as DSS_CHANGE_MODIFIED.
+     *     The caller must then treat the returned files as its complete view of the shared namespace, any file it knew which is
+     *     not returned was removed. A snapshot is never split: if the entries array cannot hold all shared files,
+     *     DSS_ENOMEM is returned and the call must be repeated with a larger array.
+     * @param[in] sinceSequence: sequence number already processed by the caller, zero to read all changes
+     * @param[out] entries: array receiving the changes
+     * @param[in] maxCount: size of the entries array
+     * @param[out] nextSequence: sequence number to give in the next call; lower than the latest sequence if entries was too small
+     * @param[out] resync: set to true if the entries are a snapshot of all shared files instead of the changes since sinceSequence
+     * @return. Number of entries written in the array,
+     *           or a negative number in case of an error, representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ENOMEM - resync is needed and the entries array is too small for the snapshot
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_ChangeFeedRead(uint64_t sinceSequence, dss_ChangeFeedEntry_t *entries, uint32_t maxCount, uint64_t *nextSequence, bool *resync) = 0;
+
+
+    /**
+     * @brief Move the content of a file into the content-addressed blob store and replace the file by a reference to the blob.
+     *     Blobs are kept under DSS_SHARED_NAMESPACE, only once per content, with a reference count.
+     *     A reference file is used as any other file: it is opened, read and mapped in read only mode without copy,
+     *     the first write copies the content back in the namespace, and dss_FileRemove releases the reference.
+     *     A namespace is charged the full size of its reference files, so quotas are the same as with private copies.
+     *     The blob itself is not charged against the quota of DSS_SHARED_NAMESPACE nor of any other namespace, so the same bytes
+     *     are never charged twice; it is only counted in dss_GetTotalUsedSpace, once per distinct content.
+     * @param[in] nsHandle: handle of the storage namespace. Obtained from dss_NamespaceOpen
+     * @param[in] fileName: null terminated string representing the name of the file. File must not be in use.
+     * @param[out] blobId: identifier of the blob, can be used with dss_BlobLink
+     * @return. Zero on success, or negative value in case of error representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ENOENT - file does not exist
+     *          DSS_EBUSY  - file is in use
+     *          DSS_ENAMETOOLONG - file name too long
+     *          DSS_ENOMEM - the content is not stored yet and there is not enough total free space for the blob
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_BlobPut(int32_t nsHandle, char const *fileName, dss_BlobId_t *blobId) = 0;
+
+
+    /**
+     * @brief Create a file referencing an existing blob of the content-addressed blob store.
+     *     The blob size is charged against the namespace quota.
+     *     A namespace can only link a blob it already references, or a blob put from DSS_SHARED_NAMESPACE: a blob put only
+     *     from private namespaces of other bundles is reported as not existing, so its content can not be read and its
+     *     existence can not be probed. Deduplication between private namespaces still happens in dss_BlobPut.
+     * @param[in] nsHandle: handle of the storage namespace. Obtained from dss_NamespaceOpen
+     * @param[in] fileName: null terminated string representing the name of the file to be created
+     * @param[in] blobId: identifier of the blob, returned by dss_BlobPut
+     * @return. Zero on success, or negative value in case of error representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ENOENT - blob does not exist, or is not linkable from this namespace
+     *          DSS_EEXIST - file already exists
+     *          DSS_ENAMETOOLONG - file name too long
+     *          DSS_ENOMEM - if there is not enough space available
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_BlobLink(int32_t nsHandle, char const *fileName, const dss_BlobId_t *blobId) = 0;
+
+
+    /**
+     * @brief Return the statistics of the content-addressed blob store.
+     *     The flash space saved by deduplication is referencedBytes - storedBytes.
+     * @param[out] stats: blob store statistics
+     * @return. Zero on success, or negative value in case of error representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_BlobGetStats(dss_BlobStoreStats_t *stats) = 0;
+
+
+    /**
+     * @brief Set the compression used for files created from now on in a namespace.
+     *     Compression is transparent for dss_FileRead, dss_FileWrite, dss_FileSeek, the positional and vectored operations
+     *     (dss_FileReadAt, dss_FileWriteAt, dss_FileReadV, dss_FileWriteV) and the asynchronous I/O queue: offsets are logical,
+     *     and a write covering part of a frame decompresses and recompresses that frame only.
+     *     Compressed files can not be mapped, dss_FileMap returns DSS_EACCES for them.
+     *     The namespace quota is charged with the compressed (physical) size of its files.
+     * @param[in] nsHandle: handle of the storage namespace. Obtained from dss_NamespaceOpen
+     * @param[in] compression: compression of the new files
+     * @return. Zero on success, or negative value in case of error representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_NamespaceSetCompression(int32_t nsHandle, dss_Compression_t compression) = 0;
+
+
+    /**
+     * @brief Change the compression of an existing file. The file is rewritten with the new compression. File must not be in use.
+     * @param[in] nsHandle: handle of the storage namespace. Obtained from dss_NamespaceOpen
+     * @param[in] fileName: null terminated string representing the name of the file
+     * @param[in] compression: new compression of the file
+     * @return. Zero on success, or negative value in case of error representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ENOENT - file does not exist
+     *          DSS_EBUSY  - file is in use
+     *          DSS_ENAMETOOLONG - file name too long
+     *          DSS_ENOMEM - if there is not enough space available (the file grows when compression is removed)
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_FileSetCompression(int32_t nsHandle, char const *fileName, dss_Compression_t compression) = 0;
+
+
+    /**
+     * @brief Returns the size used by the file on storage, as charged against the namespace quota.
+     *     For a file without compression it is equal to dss_FileGetSize.
+     * @param[in] fileHandle: handle of the opened file.
+     * @return Size of the file on storage in bytes, or negative value representing the error code, in case of error.
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_FileGetPhysicalSize(int32_t fileHandle) = 0;
+
+
+    /**
+     * @brief Start an atomic replace of a file. A new, empty shadow file is created and opened in write only mode;
+     *     the current file content stays readable by other handles until dss_FileReplaceCommit.
+     *     The shadow file is charged against the namespace quota until the replace is committed or aborted.
+     *     A shadow file left by a power loss is dropped when the namespace is opened; the file keeps its previous content.
+     *     The shadow handle is ended only by dss_FileReplaceCommit or dss_FileReplaceAbort; dss_FileClose rejects it with DSS_EINVAL.
+     * @param[in] nsHandle: handle of the storage namespace. Obtained from dss_NamespaceOpen
+     * @param[in] fileName: null terminated string representing the name of the file to replace (it does not need to exist)
+     * @return. Positive number representing the unique file handle of the shadow file, to be used with dss_FileWrite,
+     *     dss_FileWriteAt and dss_FileWriteV, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     *          DSS_EBUSY  - a replace of this file is already ongoing
+     *          DSS_ENAMETOOLONG - file name too long
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_FileReplaceBegin(int32_t nsHandle, char const *fileName) = 0;
+
+
+    /**
+     * @brief Commit an atomic replace. The shadow file is closed, synchronized on the file system, and renamed
+     *     over the file in one operation, so after a power loss the file has either its previous or its new content.
+     *     The directory of the namespace is synchronized after the rename, before the call returns: once it returns
+     *     successfully the new content survives a power loss.
+     *     For a shared file a single dss_FileChangedEvent is triggered.
+     * @param[in] fileHandle: handle of the shadow file received from dss_FileReplaceBegin.
+     * @return. Zero on success, or negative value in case of error representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_FileReplaceCommit(int32_t fileHandle) = 0;
+
+
+    /**
+     * @brief Abort an atomic replace. The shadow file is closed and removed, the file keeps its previous content.
+     * @param[in] fileHandle: handle of the shadow file received from dss_FileReplaceBegin.
+     * @return. Zero on success, or negative value in case of error representing the error code
+     *          DSS_EINVAL - invalid argument
+     */
+    virtual int32_t dss_FileReplaceAbort(int32_t fileHandle) = 0;
+
+
     /**
      * @brief Removes all files from the namespace indicated by the given argument.
      * @param[in] nsHandle: handle of the storage namespace. Obtained from dss_NamespaceOpen
@@ -205,7 +555,8 @@ public:
      * @brief Close the file given as parameter through file handle received from dss_FileOpen call.
      * @param[in] fileHandle: handle of the opened file to close.
      * @return. Zero in case of success, or negative value representing the error code in case of error
-     *          DSS_EINVAL - invalid argument
+     *          DSS_EINVAL - invalid argument (including a shadow file handle from dss_FileReplaceBegin)
+     *          DSS_EBUSY  - file is busy (at least one mapping created by dss_FileMap is still active)
      */
     virtual int32_t dss_FileClose(int32_t fileHandle) = 0;
 
@@ -224,6 +575,84 @@ public:
     virtual int32_t dss_FileSave(int32_t nsHandle, char const *fileName, bool isSynchronous) = 0;
 
 
+     /**
+     * @brief Request a deferred save of a file. Writes of the file are kept in the write-back cache, coalesced into
+     *     aligned blocks, and flushed together with the other pending saves (of any namespace) at latest when the deadline expires.
+     *     A pending save is flushed immediately by dss_FileSave with isSynchronous set to true, by dss_FlushAll,
+     *     and when the system enters E_LCM_ST_BEFORE_SLEEP.
+     *     Calling dss_FileSave with isSynchronous set to false is equivalent to a deferred save with priority DSS_FLUSH_PRIORITY_NORMAL:
+     *     if a save of the file is already pending its deadline is kept, otherwise the deadline is DSS_SAVE_DEFAULT_DEADLINE_MS.
+     *     Calling dss_FileSaveDeferred when a save of the file is already pending keeps the earliest deadline and the highest priority.
+     *     As for dss_FileSave, the file must not be in use when the save is requested.
+     * @param[in] nsHandle: handle of the storage namespace. Obtained from dss_NamespaceOpen
+     * @param[in] fileName: null terminated string representing the name of the file to be saved
+     * @param[in] deadlineMs: maximum time in milliseconds before the file is saved on file system
+     * @param[in] priority: priority of the save compared to other saves with the same deadline
+     * @return. Zero on success, or negative value in case of error representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ENOENT - file does not exist
+     *          DSS_EBUSY  - file is in use
+     *          DSS_ENAMETOOLONG - file name too long
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_FileSaveDeferred(int32_t nsHandle, char const *fileName, uint32_t deadlineMs, dss_FlushPriority_t priority) = 0;
+
+
+    /**
+     * @brief Flush all pending deferred saves of all namespaces and wait for the file system synchronization.
+     * @param[in] none
+     * @return. Zero on success, or negative value in case of error representing the error code
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_FlushAll() = 0;
+
+
+    /**
+     * @brief Return the write-back statistics of the data storage service.
+     * @param[out] stats: statistics cumulated since startup
+     * @return. Zero on success, or negative value in case of error representing the error code
+     *          DSS_EINVAL - invalid argument
+     */
+    virtual int32_t dss_GetWriteBackStats(dss_WriteBackStats_t *stats) = 0;
+
+
+    /**
+     * @brief Prefetch the files of the private namespace manifest of a bundle.
+     *     The manifest contains the files read by the bundle during DSS_PREFETCH_RECORD_WINDOW_MS after its first access,
+     *     in the lifecycle in which it was recorded; it is recorded when no manifest exists for the bundle
+     *     (see dss_NamespaceResetPrefetchManifest).
+     *     The data storage service has no cache of its own: files are read ahead in parallel into the file system page cache,
+     *     so the first reads of the bundle do not wait for the storage device. The call returns immediately.
+     *     This method is called by IEarlyInitService::getLCM_Obj.
+     * @param[in] bundleSymbolicName: bundle symbolic name extracted from bundle context
+     * @return. Zero in case of success, including when no manifest exists yet,
+     *           or a negative number in case of an error, representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_NamespacePrefetch(const std::string bundleSymbolicName) = 0;
+
+
+    /**
+     * @brief Drop the prefetch manifest of the private namespace of a bundle, a new one is recorded in the next lifecycle.
+     * @param[in] bundleSymbolicName: bundle symbolic name extracted from bundle context
+     * @return. Zero in case of success, or a negative number in case of an error, representing the error code
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_NamespaceResetPrefetchManifest(const std::string bundleSymbolicName) = 0;
+
+
+    /**
+     * @brief Return the prefetch statistics of the private namespace of a bundle.
+     * @param[in] bundleSymbolicName: bundle symbolic name extracted from bundle context
+     * @param[out] stats: prefetch statistics of the current lifecycle
+     * @return. Zero in case of success, or a negative number in case of an error, representing the error code
+     *          DSS_EINVAL - invalid argument
+     */
+    virtual int32_t dss_NamespaceGetPrefetchStats(const std::string bundleSymbolicName, dss_PrefetchStats_t *stats) = 0;
+
+
      /**
      * @brief Delete a file from the storage. File must not be in use.
      * @param[in] nsHandle: handle of the storage namespace. Obtained from dss_NamespaceOpen
@@ -239,7 +668,7 @@ public:
 
 
     /**
-     * @brief Returns the size of the file.
+     * @brief Returns the size of the file. For a compressed file the logical (uncompressed) size is returned.
      * @param[in] fileHandle: handle of the opened file to read from.
      * @return Size of the file in bytes, or negative value representing the error code, in case of error.
      *          DSS_EINVAL - invalid argument
@@ -290,6 +719,161 @@ public:
      *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
      */
     virtual int32_t dss_FileSeek(int32_t fileHandle, int32_t seekOffset, dss_SeekOffset_t seekType) = 0;
+
+
+    /**
+     * @brief Read from file at the given offset. The current file offset is neither used nor updated,
+     *     so several threads can read the same file handle concurrently.
+     * @param[in] fileHandle: handle of the opened file to read from.
+     * @param[out] readBuffer: buffer to read into
+     * @param[in] count: number of bytes to be read from file
+     * @param[in] offset: offset in bytes in the file to read from
+     * @return Number of bytes read. Zero is returned in case offset is at or after the end of file.
+     *   Negative value is returned in case of error (representing the error code)
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ENOENT - file does not exist
+     *          DSS_EBUSY  - file is busy (the file is shared and is being written)
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_FileReadAt(int32_t fileHandle, void *readBuffer, uint32_t count, uint32_t offset) = 0;
+
+
+    /**
+     * @brief Write in file at the given offset. The current file offset is neither used nor updated,
+     *     so several threads can write the same file handle concurrently (overlapping regions are not ordered).
+     * @param[in] fileHandle: handle of the opened file to write into.
+     * @param[in] writeBuffer: buffer to write from
+     * @param[in] count: number of bytes to be written to file
+     * @param[in] offset: offset in bytes in the file to write at
+     * @return Number of bytes written. Negative value is returned in case of error (representing the error code)
+     *          DSS_EINVAL - invalid argument
+     *          DSS_EBUSY  - file is in use (the file is shared and is being read)
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     *          DSS_ENOMEM - if there is not enough space available
+     */
+    virtual int32_t dss_FileWriteAt(int32_t fileHandle, const void *writeBuffer, uint32_t count, uint32_t offset) = 0;
+
+
+    /**
+     * @brief Read several regions of a file in one call. Each entry of ioVec is read at its own offset,
+     *     as with dss_FileReadAt, and its result field is updated. The current file offset is neither used nor updated.
+     * @param[in] fileHandle: handle of the opened file to read from.
+     * @param[in,out] ioVec: array of buffer descriptors
+     * @param[in] ioVecCount: number of entries in ioVec (not more than DSS_IOV_MAX)
+     * @return Total number of bytes read. Negative value is returned in case of error (representing the error code)
+     *   In case of error on a single entry, the other entries are still processed and the error is reported in the entry result.
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ENOENT - file does not exist
+     *          DSS_EBUSY  - file is busy (the file is shared and is being written)
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_FileReadV(int32_t fileHandle, dss_IoVec_t *ioVec, uint32_t ioVecCount) = 0;
+
+
+    /**
+     * @brief Write several regions of a file in one call. Each entry of ioVec is written at its own offset,
+     *     as with dss_FileWriteAt, and its result field is updated. The current file offset is neither used nor updated.
+     * @param[in] fileHandle: handle of the opened file to write into.
+     * @param[in,out] ioVec: array of buffer descriptors
+     * @param[in] ioVecCount: number of entries in ioVec (not more than DSS_IOV_MAX)
+     * @return Total number of bytes written. Negative value is returned in case of error (representing the error code)
+     *   In case of error on a single entry, the other entries are still processed and the error is reported in the entry result.
+     *          DSS_EINVAL - invalid argument
+     *          DSS_EBUSY  - file is in use (the file is shared and is being read)
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     *          DSS_ENOMEM - if there is not enough space available
+     */
+    virtual int32_t dss_FileWriteV(int32_t fileHandle, dss_IoVec_t *ioVec, uint32_t ioVecCount) = 0;
+
+
+    /**
+     * @brief Create an asynchronous I/O queue. Requests submitted to the queue are executed in the background,
+     *     possibly in parallel and in any order; their completions are retrieved with dss_IoGetCompletions,
+     *     or received through the completion callback of the queue.
+     * @param[in] depth: maximum number of requests in flight (not more than DSS_IO_QUEUE_MAX_DEPTH).
+     * @param[in] callback: if not null, called for each completion of this queue only, and completions are not
+     *     stored for dss_IoGetCompletions. Callbacks of a queue are called one at a time from a thread dedicated to the queue,
+     *     so a slow callback delays the completions of its own queue only. Null to retrieve completions with dss_IoGetCompletions.
+     * @param[in] context: caller defined value given back to each call of callback (typically the client object)
+     * @return. Positive number representing the unique queue handle, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ENOMEM - no more queue can be created
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_IoQueueCreate(uint32_t depth, dss_IoCompletionFuncPtr_t callback, void *context) = 0;
+
+
+    /**
+     * @brief Destroy an asynchronous I/O queue. Waits for the requests in flight to complete; their completions are dropped.
+     *     No callback of the queue is running or called anymore once the call returns, so the callback context can be released.
+     * @param[in] queueHandle: handle of the queue received from dss_IoQueueCreate.
+     * @return. Zero in case of success, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     *          DSS_EBUSY  - called from a completion callback of the same queue (waiting would deadlock), the queue is not destroyed
+     */
+    virtual int32_t dss_IoQueueDestroy(int32_t queueHandle) = 0;
+
+
+    /**
+     * @brief Submit a batch of requests to an asynchronous I/O queue. The call does not wait for the requests to be executed.
+     * @param[in] queueHandle: handle of the queue received from dss_IoQueueCreate.
+     * @param[in] requests: array of requests, the array itself can be reused after the call
+     * @param[in] count: number of requests
+     * @return. Number of submitted requests, lower than count if the queue is full,
+     *   or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_IoSubmit(int32_t queueHandle, const dss_IoRequest_t *requests, uint32_t count) = 0;
+
+
+    /**
+     * @brief Retrieve completions of an asynchronous I/O queue.
+     * @param[in] queueHandle: handle of the queue received from dss_IoQueueCreate.
+     * @param[out] completions: array receiving the completions
+     * @param[in] maxCount: size of the completions array
+     * @param[in] timeoutMs: maximum time to wait for at least one completion, zero to return immediately, negative to wait forever
+     * @return. Number of completions written in the array (zero on timeout),
+     *   or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument (or queue created with a completion callback)
+     */
+    virtual int32_t dss_IoGetCompletions(int32_t queueHandle, dss_IoCompletion_t *completions, uint32_t maxCount, int32_t timeoutMs) = 0;
+
+
+    /**
+     * @brief Map a region of an opened file into the caller address space. Pages are loaded only when accessed.
+     *     A read write mapping extending past the end of the file grows the file; the new size is charged
+     *     against the namespace quota (see dss_NamespaceGetQuota) when the mapping is created.
+     *     A read only mapping must stay within the file (offset + length not greater than dss_FileGetSize).
+     *     A read only mapping of a blob reference file (see dss_BlobPut) maps the blob without copy; a read write mapping
+     *     first copies the blob content back in the namespace, as the first write does, and releases the reference.
+     *     Modifications done through a read write mapping are written back to the file at latest on dss_FileUnmap,
+     *     and are persisted on the file system by dss_FileSave once the file is closed.
+     * @param[in] fileHandle: handle of the opened file to map.
+     * @param[in] offset: offset in bytes of the mapped region in the file. Must be a multiple of DSS_MAP_ALIGNMENT.
+     * @param[in] length: length in bytes of the mapped region. Must be greater than zero.
+     * @param[in] mapMode: read only or read write mapping. A read write mapping requires the file to be opened read write.
+     * @param[out] mapAddress: address of the first mapped byte
+     * @return. Positive number representing the unique mapping handle, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument (offset not aligned, length is zero, mapAddress is NULL,
+     *                       read only mapping extending past the end of the file)
+     *          DSS_EACCES - mapping mode is not compatible with the file access mode, or the file is compressed
+     *          DSS_EBUSY  - file is busy (the file is shared and is being written)
+     *          DSS_ENOMEM - if there is not enough space available in the namespace quota (including for the copy of a blob)
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_FileMap(int32_t fileHandle, uint32_t offset, uint32_t length, dss_MapMode_t mapMode, void **mapAddress) = 0;
+
+
+    /**
+     * @brief Unmap a region mapped by dss_FileMap. The mapped address must not be accessed anymore after this call.
+     *     All mappings of a file must be unmapped before the file is closed.
+     * @param[in] mapHandle: handle of the mapping received from dss_FileMap.
+     * @return. Zero in case of success, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t dss_FileUnmap(int32_t mapHandle) = 0;
 };
 
 } }
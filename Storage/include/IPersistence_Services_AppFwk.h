@@ -44,6 +44,9 @@
 #define PERSISTENCE_SERVICES_SERVICENAME_FOR_PUBLIC_ACCESS           ("PUBLIC_SRV")
 #define PERSISTENCE_SERVICES_SERVICENAME_FOR_PUBLIC_CRITICAL_ACCESS  ("PUBLIC_SEC")
 
+/* Duration after the first access of a bundle during which its key reads are recorded in its prefetch manifest */
+#define PERSISTENCE_SERVICES_PREFETCH_RECORD_WINDOW_MS               (10000)
+
 
 /***** TYPEDEFS ***********************************************************/
 
@@ -61,7 +64,8 @@ typedef enum pcl_error
     PCL_ERROR_NO_QUOTA,                            /**< Not enough space available */
     PCL_ERROR_KEY_EXISTS,                          /**< A key with the same name already exists */
     PCL_ERROR_SERVICE_DISABLED,                    /**< Service disabled */
-    PCL_ERROR_KEY_NOT_FOUND                        /**< The key was not found */
+    PCL_ERROR_KEY_NOT_FOUND,                       /**< The key was not found */
+    PCL_ERROR_STALE_HANDLE                         /**< The key handle is no longer valid (key deleted or database restored) */
 } PCL_Error_t;
 
 /**
@@ -87,6 +91,7 @@ typedef enum pcl_database_state
     PCL_DB_STATE_NORMAL,                    /**< database OK */
     PCL_DB_STATE_CORRUPTED,                 /**< database has been corrupted and the system services are recovering mandatory info */
     PCL_DB_STATE_RESTORED_TO_DEFAULT,       /**< database has been corrupted and restored, applications can start recreating their keys */
+    PCL_DB_STATE_RECOVERING,                /**< database is being verified and restored in the background, keys are available on demand (see pcl_getRecoveryProgress) */
 
     PCL_DB_STATE_LAST                       /**< used in range checks */
 } PCL_Client_DatabaseState_t;
@@ -102,6 +107,127 @@ typedef struct pcl_change_notification
     const char                  *key_id;           /**< Name of key id */
 } PCL_Client_ChangeNotification_t;
 
+/**
+ * @brief Pcl database recovery progress
+ */
+ //@serialize
+typedef struct pcl_recovery_progress
+{
+    unsigned int                total_keys;        /**< Number of keys to verify */
+    unsigned int                verified_keys;     /**< Number of keys verified (valid or restored) */
+    unsigned int                restored_keys;     /**< Number of keys restored to default */
+    unsigned int                on_demand_keys;    /**< Number of keys verified ahead of the scan because a client requested them */
+} PCL_RecoveryProgress_t;
+
+/**
+ * @brief Pcl remaining space threshold notification
+ */
+ //@serialize
+typedef struct pcl_space_threshold
+{
+    unsigned int                remaining_space;   /**< Remaining space of the quota when the threshold was crossed */
+    unsigned int                threshold_percent; /**< Threshold crossed, as set with pcl_setRemainingSpaceThreshold */
+    int                         is_below;          /**< Non zero if the remaining space dropped below the threshold, zero if it went back above */
+} PCL_SpaceThreshold_t;
+
+/**
+ * @brief Pcl read cache statistics of a bundle, cumulated since the cache of the bundle was enabled
+ */
+ //@serialize
+typedef struct pcl_cache_stats
+{
+    unsigned long long          hits;              /**< Reads served from the cache */
+    unsigned long long          misses;            /**< Reads served from the persistence backend */
+    unsigned long long          invalidations;     /**< Cached keys invalidated by a change notification, a write or a database state change */
+    unsigned int                used_size;         /**< Bytes currently used by cached values of the bundle */
+} PCL_CacheStats_t;
+
+/**
+ * @brief Pcl batch operation type
+ */
+ //@serialize
+typedef enum pcl_batch_op
+{
+    PCL_BATCH_OP_CREATE_INT = 0,                   /**< Same as pcl_keyCreateInt (pcl_keyCreateIntCritical if critical is set) */
+    PCL_BATCH_OP_CREATE_BYTE_ARRAY,                /**< Same as pcl_keyCreateByteArray (pcl_keyCreateByteArrayCritical if critical is set) */
+    PCL_BATCH_OP_WRITE_INT,                        /**< Same as pcl_KeyWriteInt */
+    PCL_BATCH_OP_WRITE_BYTE_ARRAY,                 /**< Same as pcl_KeyWriteByteArray */
+    PCL_BATCH_OP_DELETE                            /**< Same as pcl_keyDelete (pcl_keyDeleteCritical if critical is set) */
+} PCL_BatchOp_t;
+
+/**
+ * @brief Pcl batch operation, staged in a batch with pcl_batchAdd
+ */
+typedef struct pcl_batch_entry
+{
+    PCL_BatchOp_t               op;                /**< Operation type */
+    int                         critical;          /**< Non zero for a critical key */
+    const unsigned char         *bundle_symbolic_name; /**< Bundle symbolic name, NULL for shared data */
+    const unsigned char         *key_id;           /**< Key name */
+    unsigned int                value;             /**< Value for PCL_BATCH_OP_WRITE_INT, max_size for PCL_BATCH_OP_CREATE_BYTE_ARRAY */
+    int                         size;              /**< Size of buffer for PCL_BATCH_OP_WRITE_BYTE_ARRAY */
+    const unsigned char         *buffer;           /**< Data for PCL_BATCH_OP_WRITE_BYTE_ARRAY, copied by pcl_batchAdd */
+} PCL_BatchEntry_t;
+
+/**
+ * @brief Pcl multi-get request entry, used by pcl_KeyReadMulti
+ */
+typedef struct pcl_read_entry
+{
+    const unsigned char         *bundle_symbolic_name; /**< Bundle symbolic name, NULL for shared data */
+    const unsigned char         *key_id;           /**< Key name */
+    int                         is_int;            /**< Non zero to read a key of type int into value, zero to read a byte array into buffer */
+    unsigned int                value;             /**< [out] Value of a key of type int */
+    int                         size;              /**< [in] Size of buffer, [out] actual size of the byte array key */
+    unsigned char               *buffer;           /**< [out] Buffer for a key of type byte array - allocated by user */
+    PCL_Error_t                 result;            /**< [out] Result of the read, same values as pcl_KeyReadInt / pcl_KeyReadByteArray */
+} PCL_ReadEntry_t;
+
+/**
+ * @brief Pcl key handle, returned by pcl_keyResolve. The content is opaque for applications.
+ * A handle is bound to the bundle which resolved it and must not be shared with other bundles.
+ */
+ //@serialize
+typedef struct pcl_key_handle
+{
+    unsigned int                index;             /**< Index of the key in the service key table */
+    unsigned int                generation;        /**< Generation of the key table entry, used to detect stale handles */
+    unsigned long long          token;             /**< Random value drawn at resolution and recorded with the resolving bundle */
+} PCL_KeyHandle_t;
+
+/**
+ * @brief Pcl prefetch statistics of a bundle, for the current lifecycle
+ */
+ //@serialize
+typedef struct pcl_prefetch_stats
+{
+    unsigned int                manifest_keys;     /**< Number of keys in the bundle prefetch manifest */
+    unsigned int                prefetched_keys;   /**< Number of keys loaded in the read cache by the prefetch */
+    unsigned int                prefetch_hits;     /**< Reads of the bundle served by a prefetched key */
+    unsigned int                prefetch_time_ms;  /**< Duration of the prefetch */
+    unsigned int                saved_time_ms;     /**< Estimated read latency saved for the bundle (prefetch hits * average backend read latency) */
+} PCL_PrefetchStats_t;
+
+/**
+ * @brief Pcl read-only view of a key of type byte array, returned by pcl_KeyMapByteArray
+ */
+typedef struct pcl_byte_array_view
+{
+    const unsigned char         *data;             /**< First byte of the value, read-only */
+    int                         size;              /**< Size of the value in bytes */
+    unsigned int                view_id;           /**< Identifier of the view, used by pcl_KeyUnmapByteArray */
+} PCL_ByteArrayView_t;
+
+/**
+ * @brief Handle of a chunked writer created by pcl_KeyWriteBegin
+ */
+typedef int PCL_WriterHandle_t;
+
+/**
+ * @brief Handle of a batch created by pcl_batchBegin
+ */
+typedef int PCL_BatchHandle_t;
+
 typedef PCL_Error_t (* ChangeNotifyFuncPtr_t)(PCL_Client_ChangeNotification_t *pclClientKeyNotifyInfo);
 
 
@@ -139,10 +265,25 @@ public:
 
     /**
      * @brief DatabaseStateChanged Event triggered on database corruption recovery notification
+     * It is only triggered when the state changes: during an incremental recovery, once with PCL_DB_STATE_RECOVERING when
+     * the recovery starts, then once with the final state. Progress is notified by RecoveryProgressChanged.
      */
 
     Poco::BasicEvent<PCL_Client_DatabaseState_t> DatabaseStateChanged;
 
+    /**
+     * @brief RecoveryProgressChanged Event triggered during an incremental recovery each time 10% more keys are verified
+     */
+
+    Poco::BasicEvent<const PCL_RecoveryProgress_t> RecoveryProgressChanged;
+
+    /**
+     * @brief RemainingSpaceThresholdCrossed Event triggered when the remaining space of the quota crosses one of the thresholds set with pcl_setRemainingSpaceThreshold
+     * Applications filter on their own threshold_percent, the event is common to all bundles.
+     */
+
+    Poco::BasicEvent<const PCL_SpaceThreshold_t> RemainingSpaceThresholdCrossed;
+
     /**
      * IPersistence_Services_AppFwk Interfaces
      */
@@ -358,9 +499,9 @@ public:
 
     /**
      * @brief Query how much of the quota is used
+     * @brief The value is read from usage counters maintained on key create, write and delete; the backend is not queried.
      * @param[out] used_space: How much space of the quota is used
      * @return  PCL_ERROR_NONE if successful
-     * \n       PCL_ERROR_GENERIC if call to OTP function tpPCL_keyReadData fails
      * \n       PCL_ERROR_INVALID_ARG if used_space is NULL
      * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
      */
@@ -369,22 +510,310 @@ public:
 
     /**
      * @brief Query how much space is still available of the quota
+     * @brief The value is read from usage counters maintained on key create, write and delete; the backend is not queried.
      * @param[out] remaining_space: How much space of the quota is remaining
      * @return  PCL_ERROR_NONE if successful
-     * \n       PCL_ERROR_GENERIC if call to OTP function tpPCL_keyReadData fails
      * \n       PCL_ERROR_INVALID_ARG if remaining_space is NULL
      * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
      */
     virtual PCL_Error_t pcl_getRemainingSpace(unsigned int *remaining_space) = 0;
 
+    /**
+     * @brief Set the remaining space threshold of a bundle, in percent of the quota. RemainingSpaceThresholdCrossed is triggered
+     * when the remaining space drops below the threshold and when it goes back above it.
+     * @brief Each bundle has its own threshold, a bundle can not change the threshold of another bundle
+     * (same behavior as dss_SetTotalFreeSpaceThreshold).
+     * @param[in] bundle_symbolic_name: bundle symbolic name extracted from bundle context
+     * @param[in] threshold_percent: threshold in percent of the quota (1 to 99), 0 removes the threshold of the bundle
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if bundle_symbolic_name is NULL or has invalid size, or if threshold_percent is greater than 99
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_setRemainingSpaceThreshold(const unsigned char *bundle_symbolic_name, unsigned int threshold_percent) = 0;
+
     /**
      * @brief  Returns the current database state
      * @return  PCL_DB_STATE_NORMAL if no recovery occured
      * \n       PCL_DB_STATE_CORRUPTED if database has been corrupted and the system services are recovering mandatory info
      * \n       PCL_DB_STATE_RESTORED_TO_DEFAULT if database has been corrupted and restored, applications can start recreating their keys
+     * \n       PCL_DB_STATE_RECOVERING if database is being verified and restored in the background, keys are available on demand
      */
     virtual PCL_Client_DatabaseState_t pcl_getDatabaseState() = 0;
 
+    /**
+     * @brief Query the progress of the database recovery
+     * @brief While the state is PCL_DB_STATE_RECOVERING, keys are verified and restored in parallel in the background.
+     * A key read, written or deleted before being verified is verified first and the call is served as soon as this key is
+     * available, without waiting for the end of the recovery.
+     * @param[out] progress: recovery progress, all counters are 0 if no recovery occured
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if progress is NULL
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_getRecoveryProgress(PCL_RecoveryProgress_t *progress) = 0;
+
+    /**
+     * @brief Verify the keys of a bundle before the remaining keys during the database recovery.
+     * @brief Intended for critical services, which then get all their keys back without waiting for the full scan.
+     * @param[in] bundle_symbolic_name: bundle symbolic name extracted from bundle context.If bundle_symbolic_name is NULL, the shared keys are prioritized.
+     * @return  PCL_ERROR_NONE if successful, including when no recovery is ongoing
+     * \n       PCL_ERROR_INVALID_ARG if bundle_symbolic_name has invalid size
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_recoveryPrioritize(const unsigned char *bundle_symbolic_name) = 0;
+
+    /**
+     * @brief Configure the read cache of pcl_KeyReadInt and pcl_KeyReadByteArray for one bundle.
+     * @brief Values are cached per (bundle_symbolic_name, key_id) on first read. A cached key is invalidated when it is
+     * written or deleted through this service, when its change notification (see pcl_keyRegisterNotifyOnChange) is received,
+     * and all keys are invalidated on DatabaseStateChanged. A read served from the cache does not take any lock.
+     * @brief Each bundle has its own cache budget, which holds the private and shared keys read by that bundle; a bundle
+     * can only change its own budget. The default budget of a bundle and the maximum budget are set by the service
+     * configuration.
+     * @param[in] bundle_symbolic_name: bundle symbolic name extracted from bundle context
+     * @param[in] max_size: maximum number of bytes used by cached values of the bundle, 0 disables the cache of the bundle
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if bundle_symbolic_name is NULL or has invalid size, or if max_size exceeds the configured maximum
+     * \n       PCL_ERROR_INTERNAL for internal errors like memory allocation errors
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_setReadCacheSize(const unsigned char *bundle_symbolic_name, unsigned int max_size) = 0;
+
+    /**
+     * @brief Query the read cache statistics of a bundle
+     * @param[in] bundle_symbolic_name: bundle symbolic name extracted from bundle context
+     * @param[out] stats: hit, miss and invalidation counters
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if any param is NULL or bundle_symbolic_name has invalid size
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_getReadCacheStats(const unsigned char *bundle_symbolic_name, PCL_CacheStats_t *stats) = 0;
+
+    /**
+     * @brief Start a new batch of key operations. Nothing is written to the database until pcl_batchCommit.
+     * @param[out] batch: handle of the new batch
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if batch is NULL
+     * \n       PCL_ERROR_INTERNAL for internal errors like memory allocation errors
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_batchBegin(PCL_BatchHandle_t *batch) = 0;
+
+    /**
+     * @brief Stage operations in a batch. The operations are checked (arguments, key existence is checked at commit) and their data is copied.
+     * @param[in] batch: handle returned by pcl_batchBegin
+     * @param[in] entries: operations to stage, applied in order at commit
+     * @param[in] count: number of entries
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if batch is unknown, entries is NULL or an entry has invalid parameters
+     * \n       PCL_ERROR_INTERNAL for internal errors like memory allocation errors
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_batchAdd(PCL_BatchHandle_t batch, const PCL_BatchEntry_t *entries, unsigned int count) = 0;
+
+    /**
+     * @brief Commit a batch in one call to the persistence backend, with a single synchronization of the database.
+     * Either all staged operations are applied or none is. The batch handle is released in any case.
+     * Change notifications of the modified keys are sent after the commit.
+     * @param[in] batch: handle returned by pcl_batchBegin
+     * @param[out] failed_index: if not NULL and the commit fails because of an operation, index of that operation
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_KEY_NOT_FOUND if a key to write or delete was not found
+     * \n       PCL_ERROR_KEY_EXISTS if a key to create already exists
+     * \n       PCL_ERROR_NO_QUOTA if there is not enough space available
+     * \n       PCL_ERROR_GENERIC if calls to the persistence provided by OTP fail
+     * \n       PCL_ERROR_INVALID_ARG if batch is unknown
+     * \n       PCL_ERROR_INTERNAL for internal errors
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_batchCommit(PCL_BatchHandle_t batch, unsigned int *failed_index) = 0;
+
+    /**
+     * @brief Drop a batch without applying its operations.
+     * @param[in] batch: handle returned by pcl_batchBegin
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if batch is unknown
+     */
+    virtual PCL_Error_t pcl_batchAbort(PCL_BatchHandle_t batch) = 0;
+
+    /**
+     * @brief Read several keys in one call to the persistence backend. The result of each read is stored in its entry.
+     * @param[in,out] entries: keys to read and read results
+     * @param[in] count: number of entries
+     * @return  PCL_ERROR_NONE if the call was processed, even if some entries failed (check each entry result)
+     * \n       PCL_ERROR_INVALID_ARG if entries is NULL
+     * \n       PCL_ERROR_GENERIC if calls to the persistence provided by OTP fail
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_KeyReadMulti(PCL_ReadEntry_t *entries, unsigned int count) = 0;
+
+    /**
+     * @brief Resolve a key once and return a handle accepted by the *ByHandle functions.
+     * @brief Access rights are checked at resolution; calls using the handle do not compare the key strings again.
+     * The service records the handle token together with the resolving bundle, and the *ByHandle functions reject any
+     * handle whose (index, token) pair was not issued by pcl_keyResolve, so handles can not be forged by walking the indices.
+     * Resolving the same key again from another bundle returns a different token.
+     * A handle becomes stale when the key is deleted or when the database is restored to default.
+     * @param[in] bundle_symbolic_name: bundle symbolic name extracted from bundle context.If bundle_symbolic_name is NULL, the data is shared.
+	 If bundle_symbolic_name is filled and match, the data is private.
+     * @param[in] key_id: key name
+     * @param[out] handle: key handle
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_KEY_NOT_FOUND if the key was not found
+     * \n       PCL_ERROR_ACCESS_DENIED if the key can not be accessed by this bundle
+     * \n       PCL_ERROR_INVALID_ARG if key_id or handle is NULL or key_id has invalid size
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_keyResolve(const unsigned char *bundle_symbolic_name, const unsigned char *key_id, PCL_KeyHandle_t *handle) = 0;
+
+    /**
+     * @brief Read a key of type int, identified by its handle. Same behavior as pcl_KeyReadInt.
+     * @param[in] handle: key handle returned by pcl_keyResolve
+     * @param[out] value: int type value
+     * @return  same values as pcl_KeyReadInt
+     * \n       PCL_ERROR_STALE_HANDLE if the handle is no longer valid, the key must be resolved again
+     * \n       PCL_ERROR_ACCESS_DENIED if the handle was not issued by pcl_keyResolve
+     */
+    virtual PCL_Error_t pcl_KeyReadIntByHandle(PCL_KeyHandle_t handle, unsigned int *value) = 0;
+
+    /**
+     * @brief Write a key of type int, identified by its handle. Same behavior as pcl_KeyWriteInt.
+     * @param[in] handle: key handle returned by pcl_keyResolve
+     * @param[in] value: int type value
+     * @return  same values as pcl_KeyWriteInt
+     * \n       PCL_ERROR_STALE_HANDLE if the handle is no longer valid, the key must be resolved again
+     * \n       PCL_ERROR_ACCESS_DENIED if the handle was not issued by pcl_keyResolve
+     */
+    virtual PCL_Error_t pcl_KeyWriteIntByHandle(PCL_KeyHandle_t handle, unsigned int value) = 0;
+
+    /**
+     * @brief Read a key of type byte array, identified by its handle. Same behavior as pcl_KeyReadByteArray.
+     * @param[in] handle: key handle returned by pcl_keyResolve
+     * @param[in] size: size of out buffer
+     * @param[out] buffer: out buffer - allocated by user
+     * @return  same values as pcl_KeyReadByteArray
+     * \n       PCL_ERROR_STALE_HANDLE if the handle is no longer valid, the key must be resolved again
+     * \n       PCL_ERROR_ACCESS_DENIED if the handle was not issued by pcl_keyResolve
+     */
+    virtual PCL_Error_t pcl_KeyReadByteArrayByHandle(PCL_KeyHandle_t handle, const int size, unsigned char *buffer) = 0;
+
+    /**
+     * @brief Write a key of type byte array, identified by its handle. Same behavior as pcl_KeyWriteByteArray.
+     * @param[in] handle: key handle returned by pcl_keyResolve
+     * @param[in] size: size of in buffer
+     * @param[in] buffer: in buffer - provided by user
+     * @return  same values as pcl_KeyWriteByteArray
+     * \n       PCL_ERROR_STALE_HANDLE if the handle is no longer valid, the key must be resolved again
+     * \n       PCL_ERROR_ACCESS_DENIED if the handle was not issued by pcl_keyResolve
+     */
+    virtual PCL_Error_t pcl_KeyWriteByteArrayByHandle(PCL_KeyHandle_t handle, const int size, unsigned char *buffer) = 0;
+
+    /**
+     * @brief Get the size of a key of type byte array, identified by its handle. Same behavior as pcl_KeyGetSize.
+     * @param[in] handle: key handle returned by pcl_keyResolve
+     * @param[out] size: actual size of key
+     * @return  same values as pcl_KeyGetSize
+     * \n       PCL_ERROR_STALE_HANDLE if the handle is no longer valid, the key must be resolved again
+     * \n       PCL_ERROR_ACCESS_DENIED if the handle was not issued by pcl_keyResolve
+     */
+    virtual PCL_Error_t pcl_KeyGetSizeByHandle(PCL_KeyHandle_t handle, int *size) = 0;
+
+    /**
+     * @brief Get a read-only view of a key of type byte array, without copying the value.
+     * @brief The view is backed by shared memory and stays valid until pcl_KeyUnmapByteArray, even if the key is
+     * written or deleted in the meantime (the view keeps the value it was created with).
+     * @param[in] bundle_symbolic_name: bundle symbolic name extracted from bundle context.If bundle_symbolic_name is NULL, the data is shared.
+	 If bundle_symbolic_name is filled and match, the data is private.
+     * @param[in] key_id: key name
+     * @param[out] view: view of the value, including its size
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_KEY_NOT_FOUND if the key was not found
+     * \n       PCL_ERROR_INVALID_ARG if key_id or view is NULL or key_id has invalid size
+     * \n       PCL_ERROR_INTERNAL for internal errors like mapping errors
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_KeyMapByteArray(const unsigned char *bundle_symbolic_name, const unsigned char *key_id, PCL_ByteArrayView_t *view) = 0;
+
+    /**
+     * @brief Release a view returned by pcl_KeyMapByteArray. The view data must not be accessed anymore.
+     * @param[in] view: view to release
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if view is NULL or unknown
+     */
+    virtual PCL_Error_t pcl_KeyUnmapByteArray(const PCL_ByteArrayView_t *view) = 0;
+
+    /**
+     * @brief Start writing a key of type byte array in chunks.
+     * @brief Key must be created before calling this function. The stored value is replaced only by pcl_KeyWriteEnd,
+     * readers keep seeing the previous value until then.
+     * @param[in] bundle_symbolic_name: bundle symbolic name extracted from bundle context.If bundle_symbolic_name is NULL, the data is shared.
+	 If bundle_symbolic_name is filled and match, the data is private.
+     * @param[in] key_id: key name
+     * @param[in] total_size: size of the new value, not more than the key max_size
+     * @param[out] writer: handle of the chunked writer
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_KEY_NOT_FOUND if the key was not found
+     * \n       PCL_ERROR_INVALID_ARG if key_id or writer is NULL or if total_size is invalid
+     * \n       PCL_ERROR_NO_QUOTA if there is not enough space available
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_KeyWriteBegin(const unsigned char *bundle_symbolic_name, const unsigned char *key_id, int total_size, PCL_WriterHandle_t *writer) = 0;
+
+    /**
+     * @brief Append a chunk to a chunked writer.
+     * @param[in] writer: handle returned by pcl_KeyWriteBegin
+     * @param[in] size: size of in buffer, the total written must not exceed total_size
+     * @param[in] buffer: in buffer - provided by user
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if writer is unknown, buffer is NULL or total_size would be exceeded
+     * \n       PCL_ERROR_INTERNAL for internal errors
+     */
+    virtual PCL_Error_t pcl_KeyWriteChunk(PCL_WriterHandle_t writer, const int size, const unsigned char *buffer) = 0;
+
+    /**
+     * @brief Finish a chunked writer. The writer handle is released in any case.
+     * @param[in] writer: handle returned by pcl_KeyWriteBegin
+     * @param[in] commit: non zero to replace the stored value, zero to drop the written chunks
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if writer is unknown or if less than total_size bytes were written and commit is non zero
+     * \n       PCL_ERROR_GENERIC if call to OTP function tpPCL_keyWriteData fails
+     * \n       PCL_ERROR_INTERNAL for internal errors
+     */
+    virtual PCL_Error_t pcl_KeyWriteEnd(PCL_WriterHandle_t writer, int commit) = 0;
+
+    /**
+     * @brief Prefetch the keys of a bundle manifest in the read cache.
+     * @brief The manifest contains the keys read by the bundle during PERSISTENCE_SERVICES_PREFETCH_RECORD_WINDOW_MS after its
+     * first access, in the lifecycle in which it was recorded; it is recorded when no manifest exists for the bundle
+     * (see pcl_resetPrefetchManifest).
+     * The keys are read in parallel and the call returns immediately. This function is called by IEarlyInitService::getLCM_Obj.
+     * Prefetched keys are only kept if the read cache of the bundle is enabled (see pcl_setReadCacheSize).
+     * @param[in] bundle_symbolic_name: bundle symbolic name extracted from bundle context
+     * @return  PCL_ERROR_NONE if successful, including when no manifest exists yet
+     * \n       PCL_ERROR_INVALID_ARG if bundle_symbolic_name is NULL or has invalid size
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_prefetchBundle(const unsigned char *bundle_symbolic_name) = 0;
+
+    /**
+     * @brief Drop the prefetch manifest of a bundle, a new one is recorded in the next lifecycle.
+     * @param[in] bundle_symbolic_name: bundle symbolic name extracted from bundle context
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if bundle_symbolic_name is NULL or has invalid size
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_resetPrefetchManifest(const unsigned char *bundle_symbolic_name) = 0;
+
+    /**
+     * @brief Query the prefetch statistics of a bundle
+     * @param[in] bundle_symbolic_name: bundle symbolic name extracted from bundle context
+     * @param[out] stats: prefetch statistics of the current lifecycle
+     * @return  PCL_ERROR_NONE if successful
+     * \n       PCL_ERROR_INVALID_ARG if any param is NULL or bundle_symbolic_name has invalid size
+     * \n       PCL_ERROR_SERVICE_DISABLED if service is disabled
+     */
+    virtual PCL_Error_t pcl_getPrefetchStats(const unsigned char *bundle_symbolic_name, PCL_PrefetchStats_t *stats) = 0;
+
 };
 
 } }
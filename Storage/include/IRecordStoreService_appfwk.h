@@ -0,0 +1,213 @@
+#ifndef I_RECORD_STORE_APPFWK_H
+#define I_RECORD_STORE_APPFWK_H
+
+ /**
+ * \file
+ *         IRecordStoreService_appfwk.h
+ * \brief
+ *         record store service interface for macchina applications
+ *  
+ * \par Copyright Notice:
+ * \verbatim
+ * Copyright (c) 2021 Stellantis N.V.
+ * All Rights Reserved.
+ * The reproduction, transmission or use of this document or its contents is
+ * not permitted without express written authority.
+ * Offenders will be liable for damages. All rights, including rights created
+ * by patent grant or registration of a utility model or design, are reserved.
+ * \endverbatim
+ */
+/***** INCLUDES ***********************************************************/
+
+#include "Poco/OSP/Service.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Poco.h"
+#include "IDataStorageService_appfwk.h"
+
+#define RECORD_STORE_SERVICE_NAME                                    ("stla.persistence.recordstore.service")
+#define RS_MAX_RECORD_SIZE                                           (64 * 1024)
+
+/***** TYPEDEFS ***********************************************************/
+
+/* @brief Behavior of a record store when its maximum size is reached */
+//@serialize
+typedef enum {
+    RS_OVERFLOW_REJECT      = 0,  /* new records are rejected with DSS_ENOMEM */
+    RS_OVERFLOW_DROP_OLDEST       /* oldest segments are dropped to make room for new records */
+}rs_OverflowPolicy_t;
+
+/* @brief Configuration of a record store, used when the store is created */
+//@serialize
+typedef struct {
+    uint32_t            segmentSize;    /* size of one segment file in KiB */
+    uint32_t            maxSize;        /* maximum size of the store in KiB, must fit in the namespace quota */
+    uint32_t            indexInterval;  /* number of records between two sparse index entries */
+    rs_OverflowPolicy_t overflowPolicy; /* behavior when maxSize is reached */
+}rs_StoreConfig_t;
+
+/* @brief Information about a record store */
+//@serialize
+typedef struct {
+    uint64_t recordCount;               /* number of readable records */
+    uint64_t firstKey;                  /* key of the oldest readable record */
+    uint64_t lastKey;                   /* key of the newest record */
+    uint32_t usedSize;                  /* size used on storage in KiB, including records waiting for compaction */
+    uint32_t recoveredBytes;            /* bytes of torn or corrupted records dropped when the store was opened */
+}rs_StoreInfo_t;
+
+/* @brief Information about a record returned by an iterator */
+//@serialize
+typedef struct {
+    uint64_t key;                       /* key given when the record was appended */
+    uint32_t size;                      /* size of the record payload in bytes */
+}rs_RecordInfo_t;
+
+
+namespace Stla {
+namespace Persistence {
+
+/***** CLASSES ************************************************************/
+
+/**
+ * @brief Append-only record store built on data storage service namespaces.
+ *     A store is a set of segment files in a namespace. Each record is stored with its key, size and checksum;
+ *     keys must not decrease (a timestamp or a sequence number is typically used) and are indexed every
+ *     indexInterval records, so a key lookup reads at most one index interval.
+ *     Records are removed with rs_StoreTrim; the space is reclaimed by a background compaction which never
+ *     uses more than the namespace quota.
+ *     When a store is opened, the last segment is verified and records not completely written (power loss)
+ *     are dropped.
+ */
+class IRecordStoreService: public Poco::OSP::Service
+{
+public:
+    /**
+     * @brief Ptr is an AutoPtr of IRecordStoreService class type
+     */
+    typedef Poco::AutoPtr<IRecordStoreService> Ptr;
+
+    /**
+     * @brief IRecordStoreService constructor
+     */
+    IRecordStoreService() { }
+
+    /**
+     * @brief IRecordStoreService destructor
+     */
+    virtual ~IRecordStoreService() { }
+
+    /**
+     * IRecordStoreService public methods
+     */
+
+    /**
+     * @brief Open a record store in a namespace. The store is created if it does not exist.
+     * @param[in] nsHandle: handle of the storage namespace. Obtained from IDataStorageService::dss_NamespaceOpen.
+     * @param[in] storeName: null terminated string representing the name of the store.
+     * @param[in] config: configuration used if the store is created; ignored if the store already exists.
+     * @return. Positive number representing the unique store handle, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     *          DSS_EBUSY  - store is already opened
+     *          DSS_ENAMETOOLONG - store name too long
+     *          DSS_ENOMEM - maxSize does not fit in the namespace quota
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t rs_StoreOpen(int32_t nsHandle, char const *storeName, const rs_StoreConfig_t *config) = 0;
+
+
+    /**
+     * @brief Close a record store. Appended records are saved before the store is closed.
+     * @param[in] storeHandle: handle of the store received from rs_StoreOpen.
+     * @return. Zero in case of success, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     *          DSS_EBUSY  - at least one iterator is still opened
+     */
+    virtual int32_t rs_StoreClose(int32_t storeHandle) = 0;
+
+
+    /**
+     * @brief Append a record at the end of the store.
+     * @param[in] storeHandle: handle of the store received from rs_StoreOpen.
+     * @param[in] key: key of the record, greater than or equal to the key of the last record
+     * @param[in] data: record payload
+     * @param[in] size: size of the record payload in bytes (from 1 to RS_MAX_RECORD_SIZE)
+     * @return. Zero in case of success, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument (including an empty record and a key lower than the last key)
+     *          DSS_ENOMEM - store is full and overflow policy is RS_OVERFLOW_REJECT
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t rs_RecordAppend(int32_t storeHandle, uint64_t key, const void *data, uint32_t size) = 0;
+
+
+    /**
+     * @brief Make all appended records durable on the file system.
+     * @param[in] storeHandle: handle of the store received from rs_StoreOpen.
+     * @return. Zero in case of success, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t rs_StoreSync(int32_t storeHandle) = 0;
+
+
+    /**
+     * @brief Remove all records with a key lower than the given key. Space is reclaimed by the background compaction.
+     * @param[in] storeHandle: handle of the store received from rs_StoreOpen.
+     * @param[in] key: first key to keep
+     * @return. Zero in case of success, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t rs_StoreTrim(int32_t storeHandle, uint64_t key) = 0;
+
+
+    /**
+     * @brief Return information about the store.
+     * @param[in] storeHandle: handle of the store received from rs_StoreOpen.
+     * @param[out] info: store information
+     * @return. Zero in case of success, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     */
+    virtual int32_t rs_StoreGetInfo(int32_t storeHandle, rs_StoreInfo_t *info) = 0;
+
+
+    /**
+     * @brief Open an iterator over the records with a key in [fromKey, toKey], in append order.
+     *     Records appended after the iterator was opened are not returned.
+     * @param[in] storeHandle: handle of the store received from rs_StoreOpen.
+     * @param[in] fromKey: first key of the range
+     * @param[in] toKey: last key of the range
+     * @return. Positive number representing the unique iterator handle, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t rs_IteratorOpen(int32_t storeHandle, uint64_t fromKey, uint64_t toKey) = 0;
+
+
+    /**
+     * @brief Read the next record of an iterator. Records with an invalid checksum are skipped.
+     * @param[in] iteratorHandle: handle of the iterator received from rs_IteratorOpen.
+     * @param[out] info: key and size of the record
+     * @param[out] buffer: buffer to read the record payload into
+     * @param[in] bufferSize: size of the buffer in bytes
+     * @return. Size of the record payload, always positive since empty records are rejected by rs_RecordAppend.
+     *   Zero is returned when there is no more record in the range.
+     *   Negative value is returned in case of error (representing the error code)
+     *          DSS_EINVAL - invalid argument
+     *          DSS_ENOMEM - buffer is too small, info is filled and the iterator does not advance
+     *          DSS_ECONNREFUSED - storage is inaccessible (due to a connection problem, or not mounted yet)
+     */
+    virtual int32_t rs_IteratorNext(int32_t iteratorHandle, rs_RecordInfo_t *info, void *buffer, uint32_t bufferSize) = 0;
+
+
+    /**
+     * @brief Close an iterator.
+     * @param[in] iteratorHandle: handle of the iterator received from rs_IteratorOpen.
+     * @return. Zero in case of success, or negative value representing the error code in case of error
+     *          DSS_EINVAL - invalid argument
+     */
+    virtual int32_t rs_IteratorClose(int32_t iteratorHandle) = 0;
+};
+
+} }
+
+#endif
@@ -0,0 +1,127 @@
+/**
+ * \file
+ *         IClockCorrelationService.h
+ * \brief
+ *         Clock Correlation Service API
+ * 
+ * \par Copyright Notice:
+ * \verbatim
+ * Copyright (c) 2021 Stellantis N.V.
+ * All Rights Reserved.
+ * The reproduction, transmission or use of this document or its contents is
+ * not permitted without express written authority.
+ * Offenders will be liable for damages. All rights, including rights created
+ * by patent grant or registration of a utility model or design, are reserved.
+ * \endverbatim
+ */
+ 
+#ifndef CLOCK_CORRELATION_SERVICE_INTERFACE_H_
+#define CLOCK_CORRELATION_SERVICE_INTERFACE_H_
+
+/****************** Includes ************************
+ ***************************************************/
+
+/* Poco library includes */
+
+#include "Poco/OSP/Service.h"
+#include "Poco/AutoPtr.h"
+#include <string>
+#include <vector>
+#include "Poco/BasicEvent.h"
+
+/* Clock Correlation Service bundle includes */
+
+#include "IClockCorrelationServiceTypes.h"
+	
+namespace Stla
+{
+namespace ClockCorrelationService
+{
+
+/**
+ * @brief The IClockCorrelationService interface, for clock correlation service
+ *
+ * The service collects pairs of timestamps of the same instant in the different time bases
+ * (GNSS time updates, CAN frames, cellular network time, system time) and maintains an online
+ * linear fit for each pair of time bases.
+ * Fits involving CLOCK_SYSTEM_UTC are only valid while ITCUInfoService::isTimeSynchronized is true,
+ * and are restarted on each ITCUInfoService::onTimeSynchronization notification.
+ *
+ * Clients are expected to request a fit once and to convert their timestamps locally with
+ * convertTimestamp / convertTimestamps (convertCanTimestamp / convertCanTimestamps for CLOCK_CAN_RELATIVE), instead of calling the service for each timestamp.
+ */
+
+static const std::string CLOCK_CORRELATION_SERVICE_INTERFACE = "stla.networking.clock-correlation.service.base";
+
+#ifdef DOXYGEN_WORKING
+class IClockCorrelationService : public Poco::OSP::Service
+#else
+class __attribute__((visibility("default"))) IClockCorrelationService : public Poco::OSP::Service
+#endif
+{
+public:
+		/* Pointer to Service interface*/
+        typedef Poco::AutoPtr<IClockCorrelationService> Ptr;
+
+        /**
+         * @brief Destroy the IClockCorrelationService object
+         *         */
+        virtual ~IClockCorrelationService() {}
+
+		/**
+         * @brief Get the current linear fit between two time bases
+         *
+         * @param[in]   from : source time base
+         * @param[in]   to : destination time base
+         * @param[out]  fit : current fit, to be used with convertTimestamp / convertTimestamps
+         * @return   SUCCESS if the operation is succesful
+         * \n        ERROR if the operation failed due to an internal communication error
+         * \n        ERROR_INVALID_ARGUMENT if from or to is not a valid time base
+         * \n        ERROR_NOT_CORRELATED if not enough samples are available yet (fit.valid is false)
+         */
+        virtual ClockCorrelation_Error_t getClockFit(EClockBase from, EClockBase to, TClockFit &fit) = 0;
+
+		/**
+         * @brief Convert an array of timestamps from one time base to another in a single call
+         *
+         * @param[in]   from : source time base
+         * @param[in]   to : destination time base
+         * @param[in]   timestamps : timestamps in the source time base [ms]
+         * @param[out]  converted : timestamps in the destination time base [ms], same order as timestamps
+         * @return   SUCCESS if the operation is succesful
+         * \n        ERROR if the operation failed due to an internal communication error
+         * \n        ERROR_INVALID_ARGUMENT if from or to is not a valid time base
+         * \n        ERROR_NOT_CORRELATED if not enough samples are available yet
+         */
+        virtual ClockCorrelation_Error_t convertTimestamps(EClockBase from, EClockBase to, const std::vector<int64_t> &timestamps, std::vector<int64_t> &converted) = 0;
+
+		/**
+		 * @brief Poco Event triggered when a fit becomes valid, becomes invalid, or its slope or offset drifts by more than its residual
+		*/
+		Poco::BasicEvent<const TClockFit> onClockFitChanged;
+
+		/**
+        @brief    All subclasses of Service must override the type() and isA() member functions.
+        * for more details see : https://pocoproject.org/pro/docs/Poco.OSP.Service.html
+        */
+		
+        /**
+        * @brief Returns the type information for the object's class
+        */
+        const std::type_info &type() const
+        {
+                return typeid(IClockCorrelationService);
+        }
+        /**
+        * @brief Returns true if the class is a subclass of the class given by otherType.
+        */
+        bool isA(const std::type_info &otherType) const
+        {
+                std::string name(typeid(IClockCorrelationService).name());
+                return name == otherType.name() || Service::isA(otherType);
+        }
+};
+
+} /* namespace ClockCorrelationService*/
+} /* Namespace Stla*/
+#endif
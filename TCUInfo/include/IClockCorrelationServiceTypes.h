@@ -0,0 +1,183 @@
+/**
+ * \file
+ *         IClockCorrelationServiceTypes.h
+ * \brief
+ *         Clock Correlation Service API
+ * 
+ * \par Copyright Notice:
+ * \verbatim
+ * Copyright (c) 2021 Stellantis N.V.
+ * All Rights Reserved.
+ * The reproduction, transmission or use of this document or its contents is
+ * not permitted without express written authority.
+ * Offenders will be liable for damages. All rights, including rights created
+ * by patent grant or registration of a utility model or design, are reserved.
+ * \endverbatim
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#ifndef CLOCK_CORRELATION_SERVICE_TYPES_H_
+#define CLOCK_CORRELATION_SERVICE_TYPES_H_
+
+namespace Stla
+{
+namespace ClockCorrelationService
+{
+/**
+ * @brief Time bases known by the clock correlation service. All values are expressed in milliseconds.
+ */
+ //@serialize
+typedef enum
+{
+    CLOCK_SENSOR         = 0,   /**< Shared sensor time source of TGNSSPosition::timestamp, TGNSSTime::timestamp and TEnhancedPosition::timestamp */
+    CLOCK_GNSS_UTC       = 1,   /**< UTC date/time carried by TGNSSTime, as milliseconds since 1970-01-01 */
+    CLOCK_CAN_RELATIVE   = 2,   /**< CANFrameData_type::relativeTimeStamp and CANSignalData_type::relativeTimeStamp */
+    CLOCK_CELLULAR_UTC   = 3,   /**< Network time carried by Connectivity::DateTime, as milliseconds since 1970-01-01 */
+    CLOCK_SYSTEM_UTC     = 4,   /**< TCU system time, as milliseconds since 1970-01-01 */
+    CLOCK_LAST                  /**< used in range checks */
+} EClockBase;
+
+/**
+ * \brief The ClockCorrelation_Error_t defines different Clock Correlation service interface return types.
+ */
+//@serialize
+enum ClockCorrelation_Error_t
+{
+    SUCCESS,                  /**< Returned in case of success operation */
+    ERROR,                    /**< Returned in case of operation failure due to an internal communication error */
+    ERROR_INVALID_ARGUMENT,   /**< Returned when an invalid argument is passed to the API */
+    ERROR_NOT_CORRELATED      /**< Returned when not enough samples are available to correlate the two time bases */
+};
+
+/**
+ *  \brief  TClockFit linear relation between two time bases.
+ *  \details
+ *  A timestamp t expressed in the time base "from" is converted to the time base "to" as:
+ *  toReference + round((t - fromReference) * slope)
+ *  All the conversion helpers below use this formula (see scaleClockDelta), so single and bulk conversions give the same result.
+ */
+//@serialize
+typedef struct
+{
+    EClockBase from;            /**< Source time base */
+    EClockBase to;              /**< Destination time base */
+    int64_t fromReference;      /**< Reference point in the source time base [ms] */
+    int64_t toReference;        /**< Reference point in the destination time base [ms] */
+    double slope;               /**< Drift ratio between the two time bases (1.0 means no drift) */
+    double residual;            /**< RMS error of the fit [ms] */
+    uint32_t samples;           /**< Number of samples used for the fit */
+    bool valid;                 /**< false if the fit can not be used (not enough samples, time resynchronization ongoing) */
+} TClockFit;
+
+/**
+ * @brief Scale a distance between two timestamps by the fit slope and round it to the nearest integer (ties to even).
+ * Integer/double conversions use the 1.5 * 2^52 bias instead of llround or a cast, so the loops using this function
+ * have no call and no 64 bits conversion instruction and are vectorized (checked with GCC -O3 -march=x86-64-v3 -fopt-info-vec).
+ * Valid while |delta * slope| < 2^51 ms.
+ * @param[in] delta: distance to the fit fromReference [ms]
+ * @param[in] slope: fit slope
+ * @return rounded scaled distance [ms]
+ */
+inline int64_t scaleClockDelta(int64_t delta, double slope)
+{
+    const double bias = 6755399441055744.0;
+    int64_t biasBits;
+    std::memcpy(&biasBits, &bias, sizeof(bias));
+
+    const int64_t deltaBits = biasBits + delta;
+    double deltaValue;
+    std::memcpy(&deltaValue, &deltaBits, sizeof(deltaValue));
+
+    const double scaled = (deltaValue - bias) * slope + bias;
+    int64_t scaledBits;
+    std::memcpy(&scaledBits, &scaled, sizeof(scaledBits));
+    return scaledBits - biasBits;
+}
+
+/**
+ * @brief Convert one timestamp using a fit obtained from the clock correlation service.
+ * Accepts any integer type, in particular the uint64_t timestamps of TGNSSPosition and TEnhancedPosition.
+ * Not to be used for CLOCK_CAN_RELATIVE, see convertCanTimestamp.
+ * @param[in] fit: fit returned by IClockCorrelationService::getClockFit
+ * @param[in] timestamp: timestamp in the fit source time base [ms]
+ * @return timestamp in the fit destination time base [ms]
+ */
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value, int64_t>::type
+convertTimestamp(const TClockFit &fit, T timestamp)
+{
+    return fit.toReference + scaleClockDelta(static_cast<int64_t>(timestamp) - fit.fromReference, fit.slope);
+}
+
+/**
+ * @brief Convert one CAN relative timestamp using a fit obtained from the clock correlation service.
+ * The 32 bits counter wraps every 49.7 days: the distance to fromReference is computed modulo 2^32 and taken
+ * as signed, so the result is correct across a wraparound as long as the timestamp is within 24.8 days of fromReference.
+ * @param[in] fit: fit returned by IClockCorrelationService::getClockFit with from = CLOCK_CAN_RELATIVE
+ * @param[in] timestamp: CAN relative timestamp [ms]
+ * @return timestamp in the fit destination time base [ms]
+ */
+inline int64_t convertCanTimestamp(const TClockFit &fit, uint32_t timestamp)
+{
+    const int32_t delta = static_cast<int32_t>(timestamp - static_cast<uint32_t>(fit.fromReference));
+    return fit.toReference + scaleClockDelta(delta, fit.slope);
+}
+
+/**
+ * @brief Convert an array of timestamps using a fit obtained from the clock correlation service.
+ * Gives the same results as convertTimestamp; the loop is vectorized (see scaleClockDelta).
+ * Not to be used for CLOCK_CAN_RELATIVE, see convertCanTimestamps.
+ * @param[in] fit: fit returned by IClockCorrelationService::getClockFit
+ * @param[in] in: timestamps in the fit source time base [ms]
+ * @param[out] out: timestamps in the fit destination time base [ms], may be the same array as in
+ * @param[in] count: number of timestamps
+ */
+inline void convertTimestamps(const TClockFit &fit, const int64_t *in, int64_t *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = fit.toReference + scaleClockDelta(in[i] - fit.fromReference, fit.slope);
+    }
+}
+
+/**
+ * @brief Convert an array of sensor timestamps (uint64_t, as TGNSSPosition::timestamp) using a fit obtained from the
+ * clock correlation service. Same behavior as the int64_t version.
+ * @param[in] fit: fit returned by IClockCorrelationService::getClockFit
+ * @param[in] in: timestamps in the fit source time base [ms]
+ * @param[out] out: timestamps in the fit destination time base [ms]
+ * @param[in] count: number of timestamps
+ */
+inline void convertTimestamps(const TClockFit &fit, const uint64_t *in, int64_t *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = fit.toReference + scaleClockDelta(static_cast<int64_t>(in[i]) - fit.fromReference, fit.slope);
+    }
+}
+
+/**
+ * @brief Convert an array of CAN relative timestamps using a fit obtained from the clock correlation service.
+ * Gives the same results as convertCanTimestamp, including across the 32 bits counter wraparound; the loop is vectorized.
+ * @param[in] fit: fit returned by IClockCorrelationService::getClockFit with from = CLOCK_CAN_RELATIVE
+ * @param[in] in: CAN relative timestamps [ms]
+ * @param[out] out: timestamps in the fit destination time base [ms]
+ * @param[in] count: number of timestamps
+ */
+inline void convertCanTimestamps(const TClockFit &fit, const uint32_t *in, int64_t *out, std::size_t count)
+{
+    const uint32_t fromReference = static_cast<uint32_t>(fit.fromReference);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const int32_t delta = static_cast<int32_t>(in[i] - fromReference);
+        out[i] = fit.toReference + scaleClockDelta(delta, fit.slope);
+    }
+}
+
+} // namespace ClockCorrelationService
+} // namespace Stla
+
+#endif